@@ -0,0 +1,19 @@
+QT       += core concurrent
+QT       -= gui
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = tmbench
+
+SOURCES += \
+    benchmachines.cpp \
+    main.cpp
+
+HEADERS += \
+    benchmachines.h
+
+include(../core/tmcore.pri)
+
+# Peak memory is read with GetProcessMemoryInfo on Windows:
+win32: LIBS += -lpsapi
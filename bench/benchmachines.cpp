@@ -0,0 +1,150 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "benchmachines.h"
+#include <algorithm>
+
+//One transition of a corpus machine, by state id:
+struct BenchTransition
+{
+    int from;
+    int to;
+    const char *read;
+    const char *write;
+    TMMove move;
+};
+
+//Describes a machine with states q0..q(numStates - 1), starting in q0 and halting in the last state:
+static TMMachineDescription describe(int numStates, std::initializer_list<BenchTransition> transitions)
+{
+    TMMachineDescription machine;
+    for(int i = 0; i < numStates; i++)
+        machine.addState(i, i == 0, i == numStates - 1);
+    for(const BenchTransition &t : transitions)
+        machine.addTransition(t.from, t.to, t.read, t.write, t.move);
+    return machine;
+}
+
+QList<BenchMachine> benchMachines()
+{
+    QList<BenchMachine> machines;
+
+    //Unary adder: 1^n 0 1^m -> 1^(n+m)
+    BenchMachine adder;
+    adder.name = "unary-adder";
+    adder.machine = describe(4, {{0, 0, "1", "1", TMMoveRight}, {0, 1, "0", "1", TMMoveRight},
+                                {1, 1, "1", "1", TMMoveRight}, {1, 2, "-", "-", TMMoveLeft},
+                                {2, 3, "1", "-", TMMoveStay}});
+    adder.input = QString(1000, '1') + '0' + QString(1000, '1');
+    adder.twoWayTape = false;
+    machines.append(adder);
+
+    //Binary increment, carrying through a long run of ones:
+    BenchMachine increment;
+    increment.name = "binary-increment";
+    increment.machine = describe(3, {{0, 0, "0", "0", TMMoveRight}, {0, 0, "1", "1", TMMoveRight}, {0, 1, "-", "-", TMMoveLeft},
+                                    {1, 1, "1", "0", TMMoveLeft}, {1, 2, "0", "1", TMMoveStay}, {1, 2, "-", "1", TMMoveStay}});
+    increment.input = QString(5000, '1');
+    increment.twoWayTape = true;
+    machines.append(increment);
+
+    //Palindrome checker over {a, b}, quadratic in the input length:
+    BenchMachine palindrome;
+    palindrome.name = "palindrome";
+    palindrome.machine = describe(7, {{0, 1, "a", "-", TMMoveRight}, {0, 4, "b", "-", TMMoveRight}, {0, 6, "-", "-", TMMoveStay},
+                                     {1, 1, "a", "a", TMMoveRight}, {1, 1, "b", "b", TMMoveRight}, {1, 2, "-", "-", TMMoveLeft},
+                                     {2, 3, "a", "-", TMMoveLeft}, {2, 6, "-", "-", TMMoveStay},
+                                     {3, 3, "a", "a", TMMoveLeft}, {3, 3, "b", "b", TMMoveLeft}, {3, 0, "-", "-", TMMoveRight},
+                                     {4, 4, "a", "a", TMMoveRight}, {4, 4, "b", "b", TMMoveRight}, {4, 5, "-", "-", TMMoveLeft},
+                                     {5, 3, "b", "-", TMMoveLeft}, {5, 6, "-", "-", TMMoveStay}});
+    QString half;
+    for(int i = 0; i < 150; i++)
+        half += (i % 3 == 0) ? 'b' : 'a';
+    QString reversed = half;
+    std::reverse(reversed.begin(), reversed.end());
+    palindrome.input = half + reversed;
+    palindrome.twoWayTape = false;
+    machines.append(palindrome);
+
+    //The same check on two tapes: copy the input, rewind the first tape and compare, linear in the input length:
+    BenchMachine palindrome2;
+    palindrome2.name = "palindrome-2tape";
+    palindrome2.machine.setNumTapes(2);
+    for(int i = 0; i < 4; i++)
+        palindrome2.machine.addState(i, i == 0, i == 3);
+    for(const QString &s : {QString("a"), QString("b")})
+    {
+        palindrome2.machine.addTransition(0, 0, {s, "-"}, {s, s}, {TMMoveRight, TMMoveRight});
+        palindrome2.machine.addTransition(1, 1, {s, "-"}, {s, "-"}, {TMMoveLeft, TMMoveStay});
+        palindrome2.machine.addTransition(2, 2, {s, s}, {s, s}, {TMMoveRight, TMMoveLeft});
+    }
+    palindrome2.machine.addTransition(0, 1, {"-", "-"}, {"-", "-"}, {TMMoveLeft, TMMoveStay});
+    palindrome2.machine.addTransition(1, 2, {"-", "-"}, {"-", "-"}, {TMMoveRight, TMMoveLeft});
+    palindrome2.machine.addTransition(2, 3, {"-", "-"}, {"-", "-"}, {TMMoveStay, TMMoveStay});
+    palindrome2.input = palindrome.input;
+    palindrome2.twoWayTape = true;
+    machines.append(palindrome2);
+
+    //Copy machine: 1^n -> 1^n 0 1^n
+    BenchMachine copy;
+    copy.name = "copy";
+    copy.machine = describe(8, {{0, 0, "1", "1", TMMoveRight}, {0, 1, "-", "0", TMMoveLeft},
+                               {1, 1, "1", "1", TMMoveLeft}, {1, 2, "-", "-", TMMoveRight},
+                               {2, 3, "1", "X", TMMoveRight}, {2, 6, "0", "0", TMMoveLeft},
+                               {3, 3, "1", "1", TMMoveRight}, {3, 4, "0", "0", TMMoveRight},
+                               {4, 4, "1", "1", TMMoveRight}, {4, 5, "-", "1", TMMoveLeft},
+                               {5, 5, "1", "1", TMMoveLeft}, {5, 5, "0", "0", TMMoveLeft}, {5, 2, "X", "X", TMMoveRight},
+                               {6, 6, "X", "1", TMMoveLeft}, {6, 7, "-", "-", TMMoveStay}});
+    copy.input = QString(100, '1');
+    copy.twoWayTape = true;
+    machines.append(copy);
+
+    //4-state busy beaver, 107 steps on a blank tape:
+    BenchMachine bb4;
+    bb4.name = "busy-beaver-4";
+    bb4.machine = describe(5, {{0, 1, "-", "1", TMMoveRight}, {0, 1, "1", "1", TMMoveLeft},
+                              {1, 0, "-", "1", TMMoveLeft}, {1, 2, "1", "-", TMMoveLeft},
+                              {2, 4, "-", "1", TMMoveRight}, {2, 3, "1", "1", TMMoveLeft},
+                              {3, 3, "-", "1", TMMoveRight}, {3, 0, "1", "-", TMMoveRight}});
+    bb4.input = "";
+    bb4.twoWayTape = true;
+    machines.append(bb4);
+
+    //5-state busy beaver champion, 47 176 870 steps on a blank tape:
+    BenchMachine bb5;
+    bb5.name = "busy-beaver-5";
+    bb5.machine = describe(6, {{0, 1, "-", "1", TMMoveRight}, {0, 2, "1", "1", TMMoveLeft},
+                              {1, 2, "-", "1", TMMoveRight}, {1, 1, "1", "1", TMMoveRight},
+                              {2, 3, "-", "1", TMMoveRight}, {2, 4, "1", "-", TMMoveLeft},
+                              {3, 0, "-", "1", TMMoveLeft}, {3, 3, "1", "1", TMMoveLeft},
+                              {4, 5, "-", "1", TMMoveRight}, {4, 0, "1", "-", TMMoveLeft}});
+    bb5.input = "";
+    bb5.twoWayTape = true;
+    machines.append(bb5);
+
+    //A long chain of states, one per input cell, so that building dominates:
+    BenchMachine chain;
+    chain.name = "state-chain";
+    const int chainLength = 5000;
+    for(int i = 0; i <= chainLength; i++)
+        chain.machine.addState(i, i == 0, i == chainLength);
+    for(int i = 0; i < chainLength; i++)
+        chain.machine.addTransition(i, i + 1, "1", "1", TMMoveRight);
+    chain.input = QString(chainLength, '1');
+    chain.twoWayTape = false;
+    machines.append(chain);
+
+    return machines;
+}
@@ -13,20 +13,22 @@
  * If not, see <https://www.gnu.org/licenses/>.
 */
 
-#ifndef TAPEHEAD_H
-#define TAPEHEAD_H
+#ifndef BENCHMACHINES_H
+#define BENCHMACHINES_H
 
-#include <QObject>
-#include <QGraphicsPolygonItem>
-#include <QtGui>
-#include <QtCore>
+#include "tmmachinedescription.h"
+#include <QList>
+#include <QString>
 
-class TapeHead : public QObject, public QGraphicsPolygonItem
+//A reference machine, described as TuringMachine takes it, with the input to run it on:
+struct BenchMachine
 {
-    Q_OBJECT
-public:
-    //Constructor:
-    explicit TapeHead(QObject *parent = nullptr);
+    QString name;
+    TMMachineDescription machine;
+    QString input;
+    bool twoWayTape;
 };
 
-#endif // TAPEHEAD_H
+QList<BenchMachine> benchMachines();
+
+#endif // BENCHMACHINES_H
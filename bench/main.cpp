@@ -0,0 +1,380 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+#include "benchmachines.h"
+#include "turingmachine.h"
+#include "tmengine.h"
+#include "tmprocessor.h"
+#include <random>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
+//Returns the peak resident memory of this process in bytes, or 0 if it is not known. It never goes down, so
+//it is the peak of every benchmark run so far, not of the current one:
+static qint64 peakMemoryUsage()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return static_cast<qint64>(counters.PeakWorkingSetSize);
+    return 0;
+#elif defined(Q_OS_UNIX)
+    struct rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#if defined(Q_OS_MACOS)
+    return static_cast<qint64>(usage.ru_maxrss);
+#else
+    return static_cast<qint64>(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+class BenchReporter
+{
+public:
+    BenchReporter(bool csv): m_Out(stdout), m_Err(stderr), m_Csv(csv)
+    {
+        if(m_Csv)
+            m_Out << "machine,benchmark,result,steps,runs,ns_per_op,steps_per_second,trace_bytes,tape_bytes,memory_bytes,process_peak_memory_bytes\n";
+    }
+
+    void report(const QJsonObject &row)
+    {
+        if(m_Csv)
+        {
+            m_Out << row["machine"].toString() << ',' << row["benchmark"].toString() << ','
+                  << row["result"].toString() << ',' << qint64(row["steps"].toDouble()) << ','
+                  << row["runs"].toInt() << ',' << row["ns_per_op"].toDouble() << ','
+                  << row["steps_per_second"].toDouble() << ',' << qint64(row["trace_bytes"].toDouble()) << ','
+                  << qint64(row["tape_bytes"].toDouble()) << ',' << qint64(row["memory_bytes"].toDouble()) << ','
+                  << qint64(row["process_peak_memory_bytes"].toDouble()) << '\n';
+        }
+        else
+            m_Out << QJsonDocument(row).toJson(QJsonDocument::Compact) << '\n';
+        m_Out.flush();
+
+        //Human readable summary:
+        m_Err << QString("%1 %2").arg(row["machine"].toString(), -18).arg(row["benchmark"].toString(), -18);
+        if(row["benchmark"].toString() == "build")
+            m_Err << QString("%1 us/build").arg(row["ns_per_op"].toDouble() / 1000.0, 0, 'f', 2);
+        else
+            m_Err << QString("%1 steps  %2 ns/step  %3 Msteps/s  %4")
+                         .arg(qint64(row["steps"].toDouble()))
+                         .arg(row["ns_per_op"].toDouble(), 0, 'f', 2)
+                         .arg(row["steps_per_second"].toDouble() / 1e6, 0, 'f', 2)
+                         .arg(row["result"].toString());
+        m_Err << '\n';
+        m_Err.flush();
+    }
+
+private:
+    QTextStream m_Out;
+    QTextStream m_Err;
+    bool m_Csv;
+};
+
+static QJsonObject makeRow(const BenchMachine &machine, const QString &benchmark)
+{
+    QJsonObject row;
+    row["machine"] = machine.name;
+    row["benchmark"] = benchmark;
+    return row;
+}
+
+//Times constructing and building the machine from its description. build() is not idempotent, so each run gets a new TM:
+static QJsonObject benchBuild(const BenchMachine &machine, qint64 minTime)
+{
+    QElapsedTimer clock;
+    int runs = 0;
+    clock.start();
+    do
+    {
+        TuringMachine tm(machine.machine);
+        if(!tm.build())
+        {
+            //A machine that does not build is reported with its error rather than timed:
+            QJsonObject row = makeRow(machine, "build");
+            row["result"] = tm.getErrorString();
+            return row;
+        }
+        runs++;
+    } while(clock.elapsed() < minTime);
+    qint64 elapsed = clock.nsecsElapsed();
+
+    QJsonObject row = makeRow(machine, "build");
+    row["result"] = "built";
+    row["steps"] = 0;
+    row["runs"] = runs;
+    row["ns_per_op"] = double(elapsed) / runs;
+    row["steps_per_second"] = 0;
+    row["trace_bytes"] = 0;
+    row["tape_bytes"] = 0;
+    row["memory_bytes"] = 0;
+    row["process_peak_memory_bytes"] = double(peakMemoryUsage());
+    return row;
+}
+
+//Times TMProcessor::start() on the machine's input until at least minTime ms have passed:
+static QJsonObject benchRun(const BenchMachine &machine, TuringMachine *tm, const QString &benchmark,
+                            TMProcessor::ExecutionMode mode, bool recording, bool profiling, qint64 minTime)
+{
+    TMProcessor processor(nullptr);
+    processor.setExecutionMode(mode);
+    processor.setRecordingEnabled(recording);
+    processor.setProfilingEnabled(profiling);
+    processor.setLeftBounded(!machine.twoWayTape);
+
+    //The default budget lets the busy beavers halt; a recorded 5-state busy beaver would need over 1 GB of trace:
+    TMRunConfig config;
+    config.setMaxTraceMemory(std::size_t(512) << 20);
+    processor.setRunConfig(config);
+
+    QElapsedTimer clock;
+    TMProcessor::ProcessResult result = TMProcessor::Successful;
+    int runs = 0;
+    clock.start();
+    do
+    {
+        processor.setParameters(machine.input + '-', tm);
+        result = processor.start();
+        runs++;
+    } while(clock.elapsed() < minTime);
+    qint64 elapsed = clock.nsecsElapsed();
+
+    QString outcome;
+    if(result == TMProcessor::StepLimitReached)
+        outcome = "step-limit";
+    else if(result == TMProcessor::TapeLimitReached)
+        outcome = "tape-limit";
+    else if(result == TMProcessor::TimeLimitReached)
+        outcome = "time-limit";
+    else if(result == TMProcessor::TraceLimitReached)
+        outcome = "trace-limit";
+    else if(processor.getCrashString() == "")
+        outcome = "accepted";
+    else
+        outcome = "crashed";
+
+    quint64 steps = processor.getSteps();
+    double totalSteps = double(qMax<quint64>(1, steps)) * runs;
+
+    QJsonObject row = makeRow(machine, benchmark);
+    row["result"] = outcome;
+    row["steps"] = double(steps);
+    row["runs"] = runs;
+    row["ns_per_op"] = elapsed / totalSteps;
+    row["steps_per_second"] = totalSteps * 1e9 / qMax<qint64>(1, elapsed);
+    //The memory of this benchmark's own run; the process peak also covers every benchmark before it:
+    std::size_t traceBytes = processor.getTrace().getMemoryUsage();
+    std::size_t tapeBytes = processor.getTapeMemoryUsage();
+    row["trace_bytes"] = double(traceBytes);
+    row["tape_bytes"] = double(tapeBytes);
+    row["memory_bytes"] = double(traceBytes + tapeBytes);
+    row["process_peak_memory_bytes"] = double(peakMemoryUsage());
+    return row;
+}
+
+//True if two engines ended in the same configuration: status, state, step count, head, visited extent and tape:
+static bool sameRun(const TMEngine &a, const TMEngine &b)
+{
+    if(a.getStatus() != b.getStatus() || a.getCurrentState() != b.getCurrentState() || a.getSteps() != b.getSteps()
+        || a.getHeadPosition() != b.getHeadPosition() || a.getLeftmost() != b.getLeftmost() || a.getRightmost() != b.getRightmost())
+        return false;
+
+    const TMTape &tapeA = a.getTape();
+    const TMTape &tapeB = b.getTape();
+    for(std::int64_t i = tapeA.getLeftmost(); i <= tapeA.getRightmost(); i++)
+        if(tapeA.at(i) != tapeB.at(i))
+            return false;
+    return true;
+}
+
+/* Runs count random machines both stepping and accelerated and returns the number that end differently.
+ *
+ * Half of the edges loop on their state, so most machines have runs for the accelerated engine to skip over.
+ * Each machine gets a random input, step limit and tape kind. The same seed always gives the same machines.
+*/
+static int checkAccelerated(int count, quint32 seed, QTextStream &err)
+{
+    std::mt19937 random(seed);
+    int mismatches = 0;
+    for(int n = 0; n < count; n++)
+    {
+        TMCompiledMachine machine;
+        int numStates = 1 + int(random() % 4);
+        machine.setNumStates(numStates + 1);
+        machine.setStartState(0);
+        machine.setHALTState(numStates, true);
+
+        std::vector<TMSymbol> symbols(1, 0);
+        int numSymbols = 1 + int(random() % 3);
+        for(int i = 0; i < numSymbols; i++)
+            symbols.push_back(machine.addSymbol(std::string(1, char('a' + i))));
+
+        for(int state = 0; state < numStates; state++)
+        {
+            for(TMSymbol read : symbols)
+            {
+                if(random() % 6 == 0)
+                    continue;
+                bool loop = random() % 2 == 0;
+                int to = loop ? state : int(random() % (numStates + 1));
+                TMSymbol write = loop && random() % 2 ? read : symbols[random() % symbols.size()];
+                machine.addTransition(state, read, to, write, int(random() % 3) - 1);
+            }
+        }
+        machine.compile();
+
+        std::vector<TMSymbol> input(random() % 12);
+        for(TMSymbol &symbol : input)
+            symbol = symbols[random() % symbols.size()];
+
+        TMRunConfig config;
+        config.setMaxSteps(1 + random() % 50000);
+        config.setMaxTapeCells(0);
+        bool twoWay = random() % 2 == 0;
+
+        TMEngine stepped(&machine);
+        TMEngine accelerated(&machine);
+        accelerated.setAccelerated(true);
+        for(TMEngine *engine : {&stepped, &accelerated})
+        {
+            engine->setRunConfig(config);
+            engine->setLeftBounded(!twoWay);
+            engine->reset(input);
+            engine->run();
+        }
+
+        if(!sameRun(stepped, accelerated))
+        {
+            mismatches++;
+            err << QString("machine %1: stepped ended in state %2 after %3 steps with the head on %4, "
+                           "accelerated in state %5 after %6 steps with the head on %7\n")
+                       .arg(n).arg(stepped.getCurrentState()).arg(qulonglong(stepped.getSteps())).arg(qlonglong(stepped.getHeadPosition()))
+                       .arg(accelerated.getCurrentState()).arg(qulonglong(accelerated.getSteps()))
+                       .arg(qlonglong(accelerated.getHeadPosition()));
+        }
+    }
+
+    err << QString("%1 of %2 random machines ran the same accelerated as stepping\n").arg(count - mismatches).arg(count);
+    err.flush();
+    return mismatches;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName("tmbench");
+
+    //Command line options:
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Times the TM engine on a fixed set of reference machines.\n"
+                                     "Prints one JSON object per line (or CSV) to standard output and a summary to standard error.");
+    parser.addHelpOption();
+    QCommandLineOption minTimeOption("min-time", "Repeat each benchmark for at least <ms> milliseconds (default 200).", "ms", "200");
+    QCommandLineOption filterOption("filter", "Only run machines whose name contains <text>.", "text");
+    QCommandLineOption csvOption("csv", "Print CSV instead of JSON lines.");
+    QCommandLineOption listOption("list", "List the machines in the corpus and exit.");
+    QCommandLineOption checkAcceleratedOption("check-accelerated", "Instead of timing, run <n> random machines both stepping "
+                                                                   "and accelerated, report any that end differently and "
+                                                                   "exit with 1 if there are any.", "n");
+    QCommandLineOption seedOption("seed", "The seed for --check-accelerated (default 1).", "seed", "1");
+    parser.addOption(minTimeOption);
+    parser.addOption(filterOption);
+    parser.addOption(csvOption);
+    parser.addOption(listOption);
+    parser.addOption(checkAcceleratedOption);
+    parser.addOption(seedOption);
+    parser.process(a);
+
+    if(parser.isSet(checkAcceleratedOption))
+    {
+        QTextStream err(stderr);
+        bool countOk = false;
+        bool seedOk = false;
+        int count = parser.value(checkAcceleratedOption).toInt(&countOk);
+        quint32 seed = parser.value(seedOption).toUInt(&seedOk);
+        if(!countOk || !seedOk || count < 0)
+        {
+            err << "Invalid --check-accelerated or --seed value.\n";
+            return 2;
+        }
+        return checkAccelerated(count, seed, err) == 0 ? 0 : 1;
+    }
+
+    QList<BenchMachine> machines = benchMachines();
+    if(parser.isSet(listOption))
+    {
+        QTextStream out(stdout);
+        for(const BenchMachine &machine : machines)
+            out << machine.name << '\n';
+        return 0;
+    }
+
+    bool ok = false;
+    qint64 minTime = parser.value(minTimeOption).toLongLong(&ok);
+    if(!ok || minTime < 0)
+    {
+        QTextStream(stderr) << "Invalid --min-time value: " << parser.value(minTimeOption) << '\n';
+        return 2;
+    }
+
+    BenchReporter reporter(parser.isSet(csvOption));
+    for(const BenchMachine &machine : machines)
+    {
+        if(parser.isSet(filterOption) && !machine.name.contains(parser.value(filterOption)))
+            continue;
+
+        reporter.report(benchBuild(machine, minTime));
+
+        TuringMachine tm(machine.machine);
+        if(!tm.build())
+        {
+            QTextStream(stderr) << "Skipping " << machine.name << ": " << tm.getErrorString() << '\n';
+            continue;
+        }
+
+        //Multi-tape machines have one engine and no trace:
+        if(tm.getNumTapes() > 1)
+        {
+            reporter.report(benchRun(machine, &tm, "run-multitape", TMProcessor::Compiled, false, false, minTime));
+            continue;
+        }
+        reporter.report(benchRun(machine, &tm, "run-compiled", TMProcessor::Compiled, false, false, minTime));
+        reporter.report(benchRun(machine, &tm, "run-compiled-trace", TMProcessor::Compiled, true, false, minTime));
+        reporter.report(benchRun(machine, &tm, "run-compiled-profile", TMProcessor::Compiled, false, true, minTime));
+        reporter.report(benchRun(machine, &tm, "run-accelerated", TMProcessor::Accelerated, false, false, minTime));
+
+        //The interpreted engine only models the one-way tape:
+        if(!machine.twoWayTape)
+            reporter.report(benchRun(machine, &tm, "run-interpreted", TMProcessor::Interpreted, false, false, minTime));
+    }
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+# Simulation engine shared by the GUI, tmsim and any other program that evaluates TMs.
+# Only needs QtCore (and Qt concurrent for TMProcessor::startAsync()).
+
+QT = core concurrent
+
+TEMPLATE = lib
+CONFIG += staticlib c++17
+
+TARGET = tmcore
+
+SOURCES += \
+    tmbatchrunner.cpp \
+    tmcompiledmachine.cpp \
+    tmcycledetector.cpp \
+    tmdebugger.cpp \
+    tmedge.cpp \
+    tmengine.cpp \
+    tmequivalencechecker.cpp \
+    tmlanguageenumerator.cpp \
+    tmmachinedescription.cpp \
+    tmmultitapeengine.cpp \
+    tmmultitapemachine.cpp \
+    tmnondeterministicrunner.cpp \
+    tmprocessor.cpp \
+    tmprofile.cpp \
+    tmrunconfig.cpp \
+    tmrunlengthtape.cpp \
+    tmsharedtape.cpp \
+    tmstate.cpp \
+    tmsymboltable.cpp \
+    tmtape.cpp \
+    tmtrace.cpp \
+    tmtranslatedcycledetector.cpp \
+    tmxmlloader.cpp \
+    turingmachine.cpp
+
+HEADERS += \
+    tmbatchrunner.h \
+    tmcompiledmachine.h \
+    tmcycledetector.h \
+    tmdebugger.h \
+    tmedge.h \
+    tmengine.h \
+    tmequivalencechecker.h \
+    tmlanguageenumerator.h \
+    tmmachinedescription.h \
+    tmmultitapeengine.h \
+    tmmultitapemachine.h \
+    tmnondeterministicrunner.h \
+    tmprocessor.h \
+    tmprofile.h \
+    tmrunconfig.h \
+    tmrunlengthtape.h \
+    tmsharedtape.h \
+    tmstate.h \
+    tmsymboltable.h \
+    tmtape.h \
+    tmtrace.h \
+    tmtranslatedcycledetector.h \
+    tmtypes.h \
+    tmxmlloader.h \
+    turingmachine.h
@@ -0,0 +1,264 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmbatchrunner.h"
+#include <QtConcurrent>
+
+TMBatchRunner::TMBatchRunner(QObject *parent):
+    QObject(parent), m_TM(nullptr), m_Mode(TMProcessor::Compiled), m_ElapsedTime(0), m_LeftBounded(true)
+{
+    m_Watcher = new QFutureWatcher<Result>(this);
+    connect(m_Watcher, SIGNAL(progressValueChanged(int)), this, SLOT(workerProgress(int)));
+    connect(m_Watcher, SIGNAL(finished()), this, SLOT(workerFinished()));
+}
+
+TMBatchRunner::~TMBatchRunner()
+{
+    //The workers read the machine, so let them finish first:
+    this->cancel();
+    m_Watcher->waitForFinished();
+}
+
+void TMBatchRunner::run()
+{
+    if(this->isRunning())
+        return;
+
+    m_Clock.start();
+    QFuture<Result> future = QtConcurrent::mapped(m_Cases, CaseRunner{this});
+    future.waitForFinished();
+    this->collect(future.results());
+}
+
+void TMBatchRunner::startAsync()
+{
+    if(this->isRunning())
+        return;
+
+    m_Results.clear();
+    m_Clock.start();
+    m_Watcher->setFuture(QtConcurrent::mapped(m_Cases, CaseRunner{this}));
+}
+
+void TMBatchRunner::cancel()
+{
+    //Inputs already running finish within their budget; the rest are skipped:
+    m_Watcher->cancel();
+}
+
+void TMBatchRunner::workerProgress(int done)
+{
+    emit this->progress(done, m_Cases.length());
+}
+
+void TMBatchRunner::workerFinished()
+{
+    this->collect(m_Watcher->future().results());
+    emit this->finished();
+}
+
+TMBatchRunner::Result TMBatchRunner::runCase(const Case &testCase) const
+{
+    QElapsedTimer clock;
+    clock.start();
+
+    //Each input gets its own processor and engine; only the machine is shared:
+    TMProcessor processor(nullptr);
+    processor.setRecordingEnabled(false);
+    processor.setLeftBounded(m_LeftBounded);
+    processor.setRunConfig(m_Config);
+    processor.setExecutionMode(m_Mode);
+    processor.setParameters(testCase.input + '-', m_TM);
+    TMProcessor::ProcessResult processResult = processor.start();
+
+    Result result;
+    result.input = testCase.input;
+    result.steps = processor.getSteps();
+    result.expected = testCase.expected;
+    if(processResult == TMProcessor::CycleDetected || processResult == TMProcessor::TranslatedCycleDetected)
+    {
+        result.outcome = Loop;
+        result.reason = processor.getLimitString(processResult);
+    }
+    else if(processResult != TMProcessor::Successful)
+    {
+        result.outcome = LimitReached;
+        result.reason = processor.getLimitString(processResult);
+    }
+    else if(processor.getCrashString() == "")
+        result.outcome = Accepted;
+    else
+    {
+        result.outcome = Crashed;
+        result.reason = processor.getCrashString();
+    }
+
+    //The expectations are listed in the same order as the outcomes, after AnyOutcome:
+    result.passed = testCase.expected == AnyOutcome || int(testCase.expected) == int(result.outcome) + 1;
+    result.elapsedNanoseconds = clock.nsecsElapsed();
+    return result;
+}
+
+void TMBatchRunner::collect(const QList<Result> &results)
+{
+    m_Results.clear();
+    m_Results.reserve(results.length());
+    for(const Result &result : results)
+        m_Results.append(result);
+    m_ElapsedTime = m_Clock.elapsed();
+}
+
+const QVector<TMBatchRunner::Case> &TMBatchRunner::getCases() const
+{
+    return m_Cases;
+}
+
+const QVector<TMBatchRunner::Result> &TMBatchRunner::getResults() const
+{
+    return m_Results;
+}
+
+int TMBatchRunner::getNumPassed() const
+{
+    int passed = 0;
+    for(const Result &result : m_Results)
+        if(result.passed)
+            passed++;
+    return passed;
+}
+
+int TMBatchRunner::getNumFailed() const
+{
+    return m_Results.length() - this->getNumPassed();
+}
+
+int TMBatchRunner::getNumOutcomes(Outcome outcome) const
+{
+    int count = 0;
+    for(const Result &result : m_Results)
+        if(result.outcome == outcome)
+            count++;
+    return count;
+}
+
+quint64 TMBatchRunner::getTotalSteps() const
+{
+    quint64 steps = 0;
+    for(const Result &result : m_Results)
+        steps += result.steps;
+    return steps;
+}
+
+qint64 TMBatchRunner::getElapsedTime() const
+{
+    return m_ElapsedTime;
+}
+
+bool TMBatchRunner::isRunning() const
+{
+    return m_Watcher->isRunning();
+}
+
+QString TMBatchRunner::outcomeName(Outcome outcome)
+{
+    switch(outcome)
+    {
+    case Accepted:
+        return QString("ACCEPTED");
+    case Crashed:
+        return QString("CRASHED");
+    case Loop:
+        return QString("LOOP");
+    default:
+        return QString("LIMIT");
+    }
+}
+
+TMBatchRunner::Expectation TMBatchRunner::parseExpectation(const QString &text, bool *ok)
+{
+    QString word = text.trimmed().toLower();
+    Expectation expected = AnyOutcome;
+    bool known = true;
+    if(word == "accepted" || word == "accept")
+        expected = ExpectAccepted;
+    else if(word == "crashed" || word == "crash" || word == "rejected" || word == "reject")
+        expected = ExpectCrashed;
+    else if(word == "loop")
+        expected = ExpectLoop;
+    else if(word == "limit")
+        expected = ExpectLimitReached;
+    else if(word != "" && word != "any")
+        known = false;
+
+    if(ok != nullptr)
+        *ok = known;
+    return expected;
+}
+
+bool TMBatchRunner::readCases(QTextStream &stream, QVector<Case> &cases, QString &error)
+{
+    int lineNumber = 0;
+    while(!stream.atEnd())
+    {
+        QString line = stream.readLine();
+        lineNumber++;
+        QString trimmed = line.trimmed();
+        if(trimmed.isEmpty() || trimmed.startsWith('#'))
+            continue;
+
+        //A leading tab gives the empty input an expected outcome:
+        QStringList fields = line.split('\t');
+        Case testCase;
+        testCase.input = fields[0].trimmed();
+        testCase.expected = AnyOutcome;
+        if(fields.length() > 1)
+        {
+            bool ok = false;
+            testCase.expected = parseExpectation(fields[1], &ok);
+            if(!ok)
+            {
+                error = QString("Line %1: unknown expected outcome \"%2\"") .arg(lineNumber) .arg(fields[1].trimmed());
+                return false;
+            }
+        }
+        cases.append(testCase);
+    }
+    return true;
+}
+
+void TMBatchRunner::setMachine(TuringMachine *theTM)
+{
+    m_TM = theTM;
+}
+
+void TMBatchRunner::setExecutionMode(TMProcessor::ExecutionMode mode)
+{
+    m_Mode = mode;
+}
+
+void TMBatchRunner::setLeftBounded(bool bounded)
+{
+    m_LeftBounded = bounded;
+}
+
+void TMBatchRunner::setRunConfig(const TMRunConfig &config)
+{
+    m_Config = config;
+}
+
+void TMBatchRunner::setCases(const QVector<Case> &cases)
+{
+    m_Cases = cases;
+}
@@ -0,0 +1,129 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMBATCHRUNNER_H
+#define TMBATCHRUNNER_H
+
+#include "tmprocessor.h"
+#include "tmrunconfig.h"
+#include "turingmachine.h"
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QObject>
+#include <QString>
+#include <QTextStream>
+#include <QVector>
+
+/* Runs a list of inputs on one built TuringMachine across all cores and checks them against
+ * their expected outcomes.
+ *
+ * Every input gets its own TMProcessor inside QtConcurrent::mapped(). The processors only read the
+ * shared machine, so the machine must be built before a run and left alone until it is done. The
+ * results keep the order of the inputs.
+ *
+ * Suites are read one input per line. An optional expected outcome follows the input after a tab,
+ * so the output of tmsim can be fed back in as a regression suite. Empty lines and lines starting
+ * with '#' are skipped. A line whose expected outcome is not one of the known words makes readCases()
+ * fail, so a typo never turns into a case that always passes.
+*/
+class TMBatchRunner : public QObject
+{
+    Q_OBJECT
+
+public:
+    //The outcomes match the words printed by tmsim:
+    enum Outcome{Accepted, Crashed, Loop, LimitReached};
+    enum Expectation{AnyOutcome, ExpectAccepted, ExpectCrashed, ExpectLoop, ExpectLimitReached};
+
+    struct Case
+    {
+        QString input;
+        Expectation expected;
+    };
+
+    struct Result
+    {
+        QString input;
+        QString reason;
+        quint64 steps;
+        qint64 elapsedNanoseconds;
+        Outcome outcome;
+        Expectation expected;
+        bool passed;
+    };
+
+    //Constructor and destructor:
+    explicit TMBatchRunner(QObject *parent = nullptr);
+    ~TMBatchRunner();
+
+    //Accessor functions:
+    const QVector<Case> &getCases() const;
+    const QVector<Result> &getResults() const;
+    int getNumPassed() const;
+    int getNumFailed() const;
+    int getNumOutcomes(Outcome outcome) const;
+    quint64 getTotalSteps() const;
+    qint64 getElapsedTime() const;
+    bool isRunning() const;
+
+    static QString outcomeName(Outcome outcome);
+    static Expectation parseExpectation(const QString &text, bool *ok = nullptr);
+    static bool readCases(QTextStream &stream, QVector<Case> &cases, QString &error);
+
+    //Mutator functions:
+    void setMachine(TuringMachine *theTM);
+    void setExecutionMode(TMProcessor::ExecutionMode mode);
+    void setLeftBounded(bool bounded);
+    void setRunConfig(const TMRunConfig &config);
+    void setCases(const QVector<Case> &cases);
+    void run();
+    void startAsync();
+    void cancel();
+
+signals:
+    //Emitted on the runner's thread while startAsync() runs:
+    void progress(int done, int total);
+
+    //Emitted on the runner's thread once startAsync() is done or cancelled:
+    void finished();
+
+private slots:
+    void workerProgress(int done);
+    void workerFinished();
+
+private:
+    //The map functor, with result_type for QtConcurrent::mapped():
+    struct CaseRunner
+    {
+        typedef Result result_type;
+        const TMBatchRunner *runner;
+        Result operator()(const Case &testCase) const { return runner->runCase(testCase); }
+    };
+
+    Result runCase(const Case &testCase) const;
+    void collect(const QList<Result> &results);
+
+    QVector<Case> m_Cases;
+    QVector<Result> m_Results;
+    QFutureWatcher<Result> *m_Watcher;
+    TuringMachine *m_TM;
+    TMRunConfig m_Config;
+    TMProcessor::ExecutionMode m_Mode;
+    QElapsedTimer m_Clock;
+    qint64 m_ElapsedTime;
+    bool m_LeftBounded;
+};
+
+#endif // TMBATCHRUNNER_H
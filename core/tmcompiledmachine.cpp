@@ -0,0 +1,186 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmcompiledmachine.h"
+#include <algorithm>
+
+TMCompiledMachine::TMCompiledMachine()
+{
+    this->clear();
+}
+
+int TMCompiledMachine::getNumStates() const
+{
+    return m_NumStates;
+}
+
+int TMCompiledMachine::getNumSymbols() const
+{
+    return m_NumSymbols;
+}
+
+int TMCompiledMachine::getStartState() const
+{
+    return m_StartState;
+}
+
+int TMCompiledMachine::findSymbol(const std::string &name) const
+{
+    return m_Symbols.find(name);
+}
+
+const std::string &TMCompiledMachine::getSymbolName(TMSymbol symbol) const
+{
+    return m_Symbols.getName(symbol);
+}
+
+const TMSymbolTable &TMCompiledMachine::getSymbolTable() const
+{
+    return m_Symbols;
+}
+
+bool TMCompiledMachine::isEmpty() const
+{
+    return m_NumStates == 0;
+}
+
+bool TMCompiledMachine::isDeterministic() const
+{
+    return m_Deterministic;
+}
+
+int TMCompiledMachine::getNumChoices() const
+{
+    return static_cast<int>(m_Choices.size());
+}
+
+int TMCompiledMachine::getFirstChoice(int state) const
+{
+    //One past the last state gives the number of choices:
+    if(m_ChoiceStart.empty())
+        return 0;
+    return static_cast<int>(m_ChoiceStart[static_cast<std::size_t>(state) * m_Stride]);
+}
+
+const TMCompiledTransition &TMCompiledMachine::getChoice(int index, int &state, TMSymbol &read) const
+{
+    //The cell holding the choice is the last one starting at or before it:
+    auto it = std::upper_bound(m_ChoiceStart.begin(), m_ChoiceStart.end(), static_cast<std::uint32_t>(index));
+    std::size_t cell = static_cast<std::size_t>(it - m_ChoiceStart.begin()) - 1;
+    state = static_cast<int>(cell / m_Stride);
+    read = static_cast<TMSymbol>(cell % m_Stride);
+    return m_Choices[static_cast<std::size_t>(index)];
+}
+
+void TMCompiledMachine::clear()
+{
+    m_Table.clear();
+    m_Choices.clear();
+    m_ChoiceStart.assign(1, 0);
+    m_HALTStates.clear();
+    m_Symbols.clear();
+    m_Pending.clear();
+    m_NumStates = 0;
+    m_NumSymbols = m_Symbols.getNumSymbols();
+    m_Stride = 1;
+    m_StartState = 0;
+    m_Deterministic = true;
+}
+
+void TMCompiledMachine::setNumStates(int numStates)
+{
+    m_NumStates = numStates;
+    m_HALTStates.assign(numStates, 0);
+}
+
+void TMCompiledMachine::setStartState(int state)
+{
+    if(state >= 0 && state < m_NumStates)
+        m_StartState = state;
+}
+
+void TMCompiledMachine::setHALTState(int state, bool isHalt)
+{
+    if(state >= 0 && state < m_NumStates)
+        m_HALTStates[state] = isHalt ? 1 : 0;
+}
+
+TMSymbol TMCompiledMachine::addSymbol(const std::string &name)
+{
+    TMSymbol id = m_Symbols.intern(name);
+    m_NumSymbols = m_Symbols.getNumSymbols();
+    return id;
+}
+
+bool TMCompiledMachine::addTransition(int from, TMSymbol read, int to, TMSymbol write, int move)
+{
+    if(from < 0 || from >= m_NumStates || to < 0 || to >= m_NumStates)
+        return false;
+
+    PendingTransition p;
+    p.from = from;
+    p.to = to;
+    p.read = read;
+    p.write = write;
+    p.move = static_cast<std::int8_t>(move < 0 ? TMMoveLeft : (move > 0 ? TMMoveRight : TMMoveStay));
+    m_Pending.push_back(p);
+    return true;
+}
+
+void TMCompiledMachine::compile()
+{
+    //One extra column per row for symbols outside the alphabet:
+    m_Stride = m_NumSymbols + 1;
+
+    TMCompiledTransition undefined;
+    undefined.nextState = -1;
+    undefined.write = 0;
+    undefined.move = TMMoveStay;
+    m_Table.assign(static_cast<size_t>(m_NumStates) * m_Stride, undefined);
+
+    //The first edge found for a (state, symbol) pair wins, as in the interpreted engine:
+    std::vector<std::uint32_t> counts(m_Table.size() + 1, 0);
+    m_Deterministic = true;
+    for(const PendingTransition &p : m_Pending)
+    {
+        std::size_t index = static_cast<size_t>(p.from) * m_Stride + p.read;
+        counts[index + 1]++;
+        TMCompiledTransition &cell = m_Table[index];
+        if(cell.nextState >= 0)
+        {
+            m_Deterministic = false;
+            continue;
+        }
+        cell.nextState = p.to;
+        cell.write = p.write;
+        cell.move = p.move;
+    }
+
+    //Lay every choice out per cell, in edge order:
+    for(std::size_t i = 1; i < counts.size(); i++)
+        counts[i] += counts[i - 1];
+    m_ChoiceStart = counts;
+    m_Choices.resize(m_Pending.size());
+    for(const PendingTransition &p : m_Pending)
+    {
+        std::size_t index = static_cast<size_t>(p.from) * m_Stride + p.read;
+        TMCompiledTransition &choice = m_Choices[counts[index]++];
+        choice.nextState = p.to;
+        choice.write = p.write;
+        choice.move = p.move;
+    }
+    m_Pending.clear();
+    m_Pending.shrink_to_fit();
+}
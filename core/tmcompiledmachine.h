@@ -0,0 +1,115 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMCOMPILEDMACHINE_H
+#define TMCOMPILEDMACHINE_H
+
+#include "tmtypes.h"
+#include "tmsymboltable.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//One cell of the dense transition table:
+struct TMCompiledTransition
+{
+    std::int32_t nextState; //-1 if the state has no edge for the symbol
+    TMSymbol write;
+    std::int8_t move;
+};
+
+/* A flat transition table indexed by (state id, symbol id).
+ *
+ * TuringMachine::build() fills it through addSymbol()/addTransition() and then calls compile(),
+ * which lays every transition out in one contiguous array. The table has one extra column at the
+ * end of every row which is never defined; symbols that are not part of the machine's alphabet
+ * (for example letters in the input that no edge reads) all map onto that column.
+ *
+ * When a state has several edges for one symbol the table holds the first one. All of them are kept,
+ * in edge order, for nondeterministic runs; getChoices() returns them.
+*/
+class TMCompiledMachine
+{
+public:
+    //Constructor:
+    TMCompiledMachine();
+
+    //Accessor functions:
+    int getNumStates() const;
+    int getNumSymbols() const;
+    int getStartState() const;
+    int findSymbol(const std::string &name) const;
+    const std::string &getSymbolName(TMSymbol symbol) const;
+    const TMSymbolTable &getSymbolTable() const;
+    bool isEmpty() const;
+    bool isDeterministic() const;
+
+    //Every transition in (state, symbol) order, numbered from 0 to getNumChoices() - 1:
+    int getNumChoices() const;
+    int getFirstChoice(int state) const;
+    const TMCompiledTransition &getChoice(int index, int &state, TMSymbol &read) const;
+
+    //Hot loop accessors, kept inline:
+    bool isHALTState(int state) const
+    {
+        return m_HALTStates[state] != 0;
+    }
+
+    const TMCompiledTransition &getTransition(int state, TMSymbol symbol) const
+    {
+        return m_Table[state * m_Stride + (symbol < m_NumSymbols ? symbol : m_NumSymbols)];
+    }
+
+    //Every transition for the symbol; count is 0 when there is none:
+    const TMCompiledTransition *getChoices(int state, TMSymbol symbol, int &count) const
+    {
+        std::size_t cell = static_cast<std::size_t>(state) * m_Stride + (symbol < m_NumSymbols ? symbol : m_NumSymbols);
+        count = static_cast<int>(m_ChoiceStart[cell + 1] - m_ChoiceStart[cell]);
+        return m_Choices.data() + m_ChoiceStart[cell];
+    }
+
+    //Mutator functions:
+    void clear();
+    void setNumStates(int numStates);
+    void setStartState(int state);
+    void setHALTState(int state, bool isHalt);
+    TMSymbol addSymbol(const std::string &name);
+    bool addTransition(int from, TMSymbol read, int to, TMSymbol write, int move);
+    void compile();
+
+private:
+    struct PendingTransition
+    {
+        int from;
+        int to;
+        TMSymbol read;
+        TMSymbol write;
+        std::int8_t move;
+    };
+
+    std::vector<TMCompiledTransition> m_Table;
+    std::vector<TMCompiledTransition> m_Choices;
+    std::vector<std::uint32_t> m_ChoiceStart;
+    std::vector<unsigned char> m_HALTStates;
+    TMSymbolTable m_Symbols;
+    std::vector<PendingTransition> m_Pending;
+    int m_NumStates;
+    int m_NumSymbols;
+    int m_Stride;
+    int m_StartState;
+    bool m_Deterministic;
+};
+
+#endif // TMCOMPILEDMACHINE_H
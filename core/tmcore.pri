@@ -0,0 +1,15 @@
+# Include from a project to link against the engine library built by core/core.pro.
+
+QT += concurrent
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+TMCORE_LIB_DIR = $$top_builddir/core
+win32:CONFIG(release, debug|release): TMCORE_LIB_DIR = $$TMCORE_LIB_DIR/release
+else:win32:CONFIG(debug, debug|release): TMCORE_LIB_DIR = $$TMCORE_LIB_DIR/debug
+
+LIBS += -L$$TMCORE_LIB_DIR -ltmcore
+
+win32-msvc*: PRE_TARGETDEPS += $$TMCORE_LIB_DIR/tmcore.lib
+else: PRE_TARGETDEPS += $$TMCORE_LIB_DIR/libtmcore.a
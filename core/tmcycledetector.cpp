@@ -0,0 +1,167 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmcycledetector.h"
+#include <algorithm>
+
+//A copy of the run used to replay it from the initial configuration:
+struct TMCycleReplay
+{
+    TMTape tape;
+    int state;
+    std::uint64_t hash;
+
+    void load(const TMTraceSnapshot &snapshot, std::uint64_t tapeHash)
+    {
+        tape.load(snapshot.cells, snapshot.leftmost);
+        tape.setHeadPosition(snapshot.head);
+        state = snapshot.state;
+        hash = tapeHash;
+    }
+
+    bool step(const TMCompiledMachine &machine)
+    {
+        if(machine.isHALTState(state))
+            return false;
+        TMSymbol symbol = tape.read();
+        const TMCompiledTransition &t = machine.getTransition(state, symbol);
+        if(t.nextState < 0)
+            return false;
+        if(symbol != t.write)
+            hash += TMCycleDetector::cellHash(tape.getHeadPosition(), t.write) - TMCycleDetector::cellHash(tape.getHeadPosition(), symbol);
+        tape.write(t.write);
+        tape.move(t.move);
+        state = t.nextState;
+        return true;
+    }
+};
+
+TMCycleDetector::TMCycleDetector():
+    m_TapeHash(0), m_InitialHash(0), m_CheckpointHash(0), m_Power(1), m_CycleLength(0), m_CycleStart(0),
+    m_Started(false), m_Found(false)
+{
+}
+
+bool TMCycleDetector::isStarted() const
+{
+    return m_Started;
+}
+
+bool TMCycleDetector::hasCycle() const
+{
+    return m_Found;
+}
+
+std::uint64_t TMCycleDetector::getCycleLength() const
+{
+    return m_CycleLength;
+}
+
+std::uint64_t TMCycleDetector::getCycleStart() const
+{
+    return m_CycleStart;
+}
+
+void TMCycleDetector::clear()
+{
+    m_Initial = TMTraceSnapshot();
+    m_Checkpoint = TMTraceSnapshot();
+    m_TapeHash = 0;
+    m_InitialHash = 0;
+    m_CheckpointHash = 0;
+    m_Power = 1;
+    m_CycleLength = 0;
+    m_CycleStart = 0;
+    m_Started = false;
+    m_Found = false;
+}
+
+void TMCycleDetector::begin(const TMTape &tape, int state, std::uint64_t step)
+{
+    this->clear();
+    m_TapeHash = hashTape(tape);
+    this->saveCheckpoint(step, state, tape);
+    m_Initial = m_Checkpoint;
+    m_InitialHash = m_TapeHash;
+    m_Started = true;
+}
+
+void TMCycleDetector::findCycleStart(const TMCompiledMachine &machine)
+{
+    if(!m_Found)
+        return;
+
+    //Start one copy at the initial configuration and another one cycle length ahead of it:
+    TMCycleReplay tortoise;
+    TMCycleReplay hare;
+    tortoise.load(m_Initial, m_InitialHash);
+    hare.load(m_Initial, m_InitialHash);
+    for(std::uint64_t i = 0; i < m_CycleLength; i++)
+        if(!hare.step(machine))
+            return;
+
+    //The first step at which both are in the same configuration is where the cycle starts:
+    std::uint64_t step = m_Initial.step;
+    while(step < m_CycleStart)
+    {
+        if(tortoise.state == hare.state && tortoise.tape.getHeadPosition() == hare.tape.getHeadPosition() &&
+                tortoise.hash == hare.hash && sameTape(tortoise.tape, hare.tape))
+            break;
+        if(!tortoise.step(machine) || !hare.step(machine))
+            return;
+        step++;
+    }
+    m_CycleStart = step;
+}
+
+std::uint64_t TMCycleDetector::hashTape(const TMTape &tape)
+{
+    std::uint64_t hash = 0;
+    std::vector<TMSymbol> cells = tape.getCells(tape.getLeftmost(), tape.getRightmost());
+    for(std::size_t i = 0; i < cells.size(); i++)
+        hash += cellHash(tape.getLeftmost() + static_cast<std::int64_t>(i), cells[i]);
+    return hash;
+}
+
+bool TMCycleDetector::sameTape(const TMTape &a, const TMTape &b)
+{
+    std::int64_t from = std::min(a.getLeftmost(), b.getLeftmost());
+    std::int64_t to = std::max(a.getRightmost(), b.getRightmost());
+    return a.getCells(from, to) == b.getCells(from, to);
+}
+
+bool TMCycleDetector::matchesCheckpoint(const TMTape &tape) const
+{
+    //Cells outside either extent are blank:
+    std::int64_t from = std::min(tape.getLeftmost(), m_Checkpoint.leftmost);
+    std::int64_t to = std::max(tape.getRightmost(), m_Checkpoint.leftmost + static_cast<std::int64_t>(m_Checkpoint.cells.size()) - 1);
+    std::vector<TMSymbol> cells = tape.getCells(from, to);
+    for(std::size_t i = 0; i < cells.size(); i++)
+    {
+        if(cells[i] != m_Checkpoint.at(from + static_cast<std::int64_t>(i)))
+            return false;
+    }
+    return true;
+}
+
+void TMCycleDetector::saveCheckpoint(std::uint64_t step, int state, const TMTape &tape)
+{
+    m_Checkpoint.step = step;
+    m_Checkpoint.head = tape.getHeadPosition();
+    m_Checkpoint.leftmost = tape.getLeftmost();
+    m_Checkpoint.cells = tape.getCells(tape.getLeftmost(), tape.getRightmost());
+    m_Checkpoint.state = state;
+    m_CheckpointHash = m_TapeHash;
+}
@@ -0,0 +1,110 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMCYCLEDETECTOR_H
+#define TMCYCLEDETECTOR_H
+
+#include "tmcompiledmachine.h"
+#include "tmtape.h"
+#include "tmtrace.h"
+#include "tmtypes.h"
+#include <cstdint>
+
+/* Detects a run that has returned to an earlier configuration (state, head position and tape), which
+ * means the machine loops forever.
+ *
+ * The tape is summarized by a hash that is updated in O(1) on every write: each non-blank cell adds a
+ * hash of its position and symbol, and blank cells add nothing. Configurations are compared against
+ * a saved checkpoint using Brent's algorithm: the checkpoint moves to the current configuration
+ * whenever the distance to it reaches the next power of two, so the first match gives the exact cycle
+ * length. A hash match is confirmed by comparing the full tape before a cycle is reported.
+ * findCycleStart() then replays the run from the initial configuration to find the step the cycle
+ * is entered.
+*/
+class TMCycleDetector
+{
+public:
+    //Constructor:
+    TMCycleDetector();
+
+    //Accessor functions:
+    bool isStarted() const;
+    bool hasCycle() const;
+    std::uint64_t getCycleLength() const;
+    std::uint64_t getCycleStart() const;
+
+    //Mutator functions:
+    void clear();
+    void begin(const TMTape &tape, int state, std::uint64_t step);
+    void findCycleStart(const TMCompiledMachine &machine);
+
+    //Hot loop functions, kept inline:
+    void write(std::int64_t position, TMSymbol oldSymbol, TMSymbol newSymbol)
+    {
+        if(oldSymbol != newSymbol)
+            m_TapeHash += cellHash(position, newSymbol) - cellHash(position, oldSymbol);
+    }
+
+    //Returns true if the configuration after the given step was seen before:
+    bool check(std::uint64_t step, int state, const TMTape &tape)
+    {
+        if(state == m_Checkpoint.state && tape.getHeadPosition() == m_Checkpoint.head &&
+                m_TapeHash == m_CheckpointHash && this->matchesCheckpoint(tape))
+        {
+            m_CycleLength = step - m_Checkpoint.step;
+            m_CycleStart = m_Checkpoint.step;
+            m_Found = true;
+            return true;
+        }
+
+        if(step - m_Checkpoint.step >= m_Power)
+        {
+            this->saveCheckpoint(step, state, tape);
+            m_Power *= 2;
+        }
+        return false;
+    }
+
+    static std::uint64_t cellHash(std::int64_t position, TMSymbol symbol)
+    {
+        if(symbol == 0)
+            return 0;
+
+        //splitmix64 finalizer:
+        std::uint64_t x = static_cast<std::uint64_t>(position) * 0x9E3779B97F4A7C15ULL + symbol;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+private:
+    static std::uint64_t hashTape(const TMTape &tape);
+    static bool sameTape(const TMTape &a, const TMTape &b);
+    bool matchesCheckpoint(const TMTape &tape) const;
+    void saveCheckpoint(std::uint64_t step, int state, const TMTape &tape);
+
+    TMTraceSnapshot m_Initial;
+    TMTraceSnapshot m_Checkpoint;
+    std::uint64_t m_TapeHash;
+    std::uint64_t m_InitialHash;
+    std::uint64_t m_CheckpointHash;
+    std::uint64_t m_Power;
+    std::uint64_t m_CycleLength;
+    std::uint64_t m_CycleStart;
+    bool m_Started;
+    bool m_Found;
+};
+
+#endif // TMCYCLEDETECTOR_H
@@ -0,0 +1,223 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmdebugger.h"
+#include <algorithm>
+
+TMDebugger::TMDebugger():
+    m_Trace(nullptr), m_HitBreakpoint(NoBreakpoint)
+{
+    this->setTrace(nullptr);
+}
+
+const TMTrace *TMDebugger::getTrace() const
+{
+    return m_Trace;
+}
+
+std::uint64_t TMDebugger::getStep() const
+{
+    return m_Configuration.step;
+}
+
+std::uint64_t TMDebugger::getNumSteps() const
+{
+    return m_Trace != nullptr ? m_Trace->getNumSteps() : 0;
+}
+
+const TMTraceSnapshot &TMDebugger::getConfiguration() const
+{
+    return m_Configuration;
+}
+
+int TMDebugger::getState() const
+{
+    return m_Configuration.state;
+}
+
+std::int64_t TMDebugger::getHeadPosition() const
+{
+    return m_Configuration.head;
+}
+
+std::int64_t TMDebugger::getHeadAt(std::uint64_t step) const
+{
+    return m_Trace != nullptr ? m_Trace->getHeadAt(step) : 0;
+}
+
+TMSymbol TMDebugger::read() const
+{
+    return m_Configuration.at(m_Configuration.head);
+}
+
+const std::vector<TMDebugger::Breakpoint> &TMDebugger::getBreakpoints() const
+{
+    return m_Breakpoints;
+}
+
+int TMDebugger::findBreakpoint(std::uint64_t step) const
+{
+    //Returns the first breakpoint that hits at configuration step:
+    if(m_Trace == nullptr || step > m_Trace->getNumSteps())
+        return NoBreakpoint;
+
+    std::uint64_t numSteps = m_Trace->getNumSteps();
+    for(std::size_t i = 0; i < m_Breakpoints.size(); i++)
+    {
+        const Breakpoint &b = m_Breakpoints[i];
+        bool hit = false;
+        switch(b.type)
+        {
+        case StateBreakpoint:
+            hit = m_Trace->getStateAt(step) == b.state;
+            break;
+        case TransitionBreakpoint:
+            hit = step < numSteps && m_Trace->getStep(step).fromState == b.state && m_Trace->getStep(step).oldSymbol == b.symbol;
+            break;
+        case WriteBreakpoint:
+            hit = step > 0 && m_Trace->getStep(step - 1).newSymbol == b.symbol;
+            break;
+        case HeadBreakpoint:
+            hit = this->getHeadAt(step) == b.position;
+            break;
+        }
+        if(hit)
+            return static_cast<int>(i);
+    }
+    return NoBreakpoint;
+}
+
+int TMDebugger::getHitBreakpoint() const
+{
+    return m_HitBreakpoint;
+}
+
+bool TMDebugger::isAtStart() const
+{
+    return m_Configuration.step == 0;
+}
+
+bool TMDebugger::isAtEnd() const
+{
+    return m_Configuration.step >= this->getNumSteps();
+}
+
+void TMDebugger::setTrace(const TMTrace *trace)
+{
+    //Start at the first configuration. Breakpoints are kept, as they usually outlive one run:
+    m_Trace = trace;
+    m_HitBreakpoint = NoBreakpoint;
+    if(m_Trace == nullptr || m_Trace->isEmpty())
+    {
+        m_Trace = nullptr;
+        m_Configuration = TMTraceSnapshot{0, 0, 0, std::vector<TMSymbol>(), 0};
+        return;
+    }
+    m_Configuration = m_Trace->getSnapshot(0);
+}
+
+void TMDebugger::addBreakpoint(const Breakpoint &breakpoint)
+{
+    m_Breakpoints.push_back(breakpoint);
+}
+
+void TMDebugger::removeBreakpoint(int index)
+{
+    if(index >= 0 && index < static_cast<int>(m_Breakpoints.size()))
+        m_Breakpoints.erase(m_Breakpoints.begin() + index);
+}
+
+void TMDebugger::clearBreakpoints()
+{
+    m_Breakpoints.clear();
+}
+
+bool TMDebugger::stepForward()
+{
+    m_HitBreakpoint = NoBreakpoint;
+    if(this->isAtEnd())
+        return false;
+    m_Configuration.applyStep(m_Trace->getStep(m_Configuration.step));
+    return true;
+}
+
+bool TMDebugger::stepBack()
+{
+    m_HitBreakpoint = NoBreakpoint;
+    if(m_Trace == nullptr || this->isAtStart())
+        return false;
+    m_Configuration.undoStep(m_Trace->getStep(m_Configuration.step - 1));
+    return true;
+}
+
+void TMDebugger::goToStep(std::uint64_t step)
+{
+    m_HitBreakpoint = NoBreakpoint;
+    if(m_Trace == nullptr)
+        return;
+    step = std::min(step, m_Trace->getNumSteps());
+
+    //Walk the deltas when that is no more work than replaying from a keyframe, which are at least
+    //this far apart:
+    std::uint64_t current = m_Configuration.step;
+    std::uint64_t walk = std::max<std::uint64_t>(m_Trace->getKeyframeInterval(), m_Configuration.cells.size());
+    if(step >= current && step - current <= walk)
+    {
+        while(m_Configuration.step < step)
+            m_Configuration.applyStep(m_Trace->getStep(m_Configuration.step));
+    }
+    else if(step < current && current - step <= walk)
+    {
+        while(m_Configuration.step > step)
+            m_Configuration.undoStep(m_Trace->getStep(m_Configuration.step - 1));
+    }
+    else
+        m_Configuration = m_Trace->getSnapshot(step);
+}
+
+bool TMDebugger::runForward()
+{
+    //Stops at the next configuration with a breakpoint, or at the end of the trace:
+    std::uint64_t numSteps = this->getNumSteps();
+    for(std::uint64_t step = m_Configuration.step + 1; step <= numSteps; step++)
+    {
+        int hit = this->findBreakpoint(step);
+        if(hit != NoBreakpoint)
+        {
+            this->goToStep(step);
+            m_HitBreakpoint = hit;
+            return true;
+        }
+    }
+    this->goToStep(numSteps);
+    return false;
+}
+
+bool TMDebugger::runBack()
+{
+    //Stops at the previous configuration with a breakpoint, or at the start:
+    for(std::uint64_t step = m_Configuration.step; step > 0; step--)
+    {
+        int hit = this->findBreakpoint(step - 1);
+        if(hit != NoBreakpoint)
+        {
+            this->goToStep(step - 1);
+            m_HitBreakpoint = hit;
+            return true;
+        }
+    }
+    this->goToStep(0);
+    return false;
+}
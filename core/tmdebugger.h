@@ -0,0 +1,90 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMDEBUGGER_H
+#define TMDEBUGGER_H
+
+#include "tmtrace.h"
+#include "tmtypes.h"
+#include <cstdint>
+#include <vector>
+
+/* Moves a cursor backwards and forwards through a recorded TMTrace.
+ *
+ * The configuration at the cursor (state, head and visited tape) is kept up to date one delta at a
+ * time for short moves, in either direction: a step forward writes the step's new symbol and moves
+ * the head, a step back writes its old symbol and puts the head back. Longer jumps rebuild the
+ * configuration from the trace's nearest keyframe with TMTrace::getSnapshot(), so going to any step
+ * costs at most one keyframe interval of deltas however long the run was.
+ *
+ * Configuration n is the one before step n runs; configuration getNumSteps() is the final one.
+ * Breakpoints are checked on configurations: a state or head breakpoint hits when the machine is in
+ * the state or the head is on the cell, a transition breakpoint when the next step is taken from the
+ * state reading the symbol, and a write breakpoint right after a step wrote the symbol.
+ *
+ * The debugger only reads the trace, which must outlive it or be replaced with setTrace().
+*/
+class TMDebugger
+{
+public:
+    enum BreakpointType {StateBreakpoint, TransitionBreakpoint, WriteBreakpoint, HeadBreakpoint};
+    enum {NoBreakpoint = -1};
+
+    //Unused fields are ignored; a transition breakpoint uses both state and symbol:
+    struct Breakpoint
+    {
+        BreakpointType type;
+        int state;
+        TMSymbol symbol;
+        std::int64_t position;
+    };
+
+    //Constructor:
+    TMDebugger();
+
+    //Accessor functions:
+    const TMTrace *getTrace() const;
+    std::uint64_t getStep() const;
+    std::uint64_t getNumSteps() const;
+    const TMTraceSnapshot &getConfiguration() const;
+    int getState() const;
+    std::int64_t getHeadPosition() const;
+    std::int64_t getHeadAt(std::uint64_t step) const;
+    TMSymbol read() const;
+    const std::vector<Breakpoint> &getBreakpoints() const;
+    int findBreakpoint(std::uint64_t step) const;
+    int getHitBreakpoint() const;
+    bool isAtStart() const;
+    bool isAtEnd() const;
+
+    //Mutator functions:
+    void setTrace(const TMTrace *trace);
+    void addBreakpoint(const Breakpoint &breakpoint);
+    void removeBreakpoint(int index);
+    void clearBreakpoints();
+    bool stepForward();
+    bool stepBack();
+    void goToStep(std::uint64_t step);
+    bool runForward();
+    bool runBack();
+
+private:
+    const TMTrace *m_Trace;
+    TMTraceSnapshot m_Configuration;
+    std::vector<Breakpoint> m_Breakpoints;
+    int m_HitBreakpoint;
+};
+
+#endif // TMDEBUGGER_H
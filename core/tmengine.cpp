@@ -0,0 +1,413 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmengine.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+TMEngine::TMEngine(const TMCompiledMachine *machine):
+    m_Machine(machine), m_Profile(nullptr), m_Steps(0), m_ElapsedNanoseconds(0), m_State(0), m_Status(Running), m_LeftBounded(true),
+    m_Accelerated(false), m_RunAccelerated(false), m_TapeStale(false)
+{
+}
+
+TMEngine::Status TMEngine::getStatus() const
+{
+    return m_Status;
+}
+
+int TMEngine::getCurrentState() const
+{
+    return m_State;
+}
+
+std::int64_t TMEngine::getHeadPosition() const
+{
+    if(m_RunAccelerated)
+        return m_RunLengthTape.getHeadPosition();
+    return m_Tape.getHeadPosition();
+}
+
+std::int64_t TMEngine::getLeftmost() const
+{
+    if(m_RunAccelerated)
+        return m_RunLengthTape.getLeftmost();
+    return m_Tape.getLeftmost();
+}
+
+std::int64_t TMEngine::getRightmost() const
+{
+    if(m_RunAccelerated)
+        return m_RunLengthTape.getRightmost();
+    return m_Tape.getRightmost();
+}
+
+TMSymbol TMEngine::read() const
+{
+    if(m_RunAccelerated)
+        return m_RunLengthTape.read();
+    return m_Tape.read();
+}
+
+std::uint64_t TMEngine::getSteps() const
+{
+    return m_Steps;
+}
+
+std::int64_t TMEngine::getElapsedTime() const
+{
+    return m_ElapsedNanoseconds / 1000000;
+}
+
+const TMTape &TMEngine::getTape() const
+{
+    //Write out the run-length encoded tape of an accelerated run:
+    if(m_TapeStale)
+    {
+        m_RunLengthTape.toTape(m_Tape);
+        m_TapeStale = false;
+    }
+    return m_Tape;
+}
+
+std::size_t TMEngine::getTapeMemoryUsage() const
+{
+    //The tape the last run used, without writing out a run-length encoded one:
+    if(m_RunAccelerated)
+        return m_RunLengthTape.getMemoryUsage();
+    return m_Tape.getMemoryUsage();
+}
+
+const TMRunConfig &TMEngine::getRunConfig() const
+{
+    return m_Config;
+}
+
+const TMCycleDetector &TMEngine::getCycleDetector() const
+{
+    return m_CycleDetector;
+}
+
+const TMTranslatedCycleDetector &TMEngine::getTranslatedCycleDetector() const
+{
+    return m_TranslatedCycleDetector;
+}
+
+bool TMEngine::isLeftBounded() const
+{
+    return m_LeftBounded;
+}
+
+bool TMEngine::isAccelerated() const
+{
+    return m_Accelerated;
+}
+
+void TMEngine::setMachine(const TMCompiledMachine *machine)
+{
+    m_Machine = machine;
+}
+
+void TMEngine::setLeftBounded(bool bounded)
+{
+    m_LeftBounded = bounded;
+}
+
+void TMEngine::setRunConfig(const TMRunConfig &config)
+{
+    m_Config = config;
+}
+
+void TMEngine::setAccelerated(bool accelerated)
+{
+    //Takes effect at the next reset():
+    m_Accelerated = accelerated;
+}
+
+void TMEngine::setProfile(TMProfile *profile)
+{
+    //The profile is filled from the next call to run(); it is not cleared here:
+    m_Profile = profile;
+}
+
+void TMEngine::reset(const std::vector<TMSymbol> &input)
+{
+    //Every cell outside the input reads as blank. The run keeps the mode it was reset in:
+    m_RunAccelerated = m_Accelerated;
+    if(m_RunAccelerated)
+    {
+        m_RunLengthTape.load(input);
+        m_TapeStale = true;
+    }
+    else
+    {
+        m_Tape.load(input);
+        m_TapeStale = false;
+    }
+    m_Steps = 0;
+    m_ElapsedNanoseconds = 0;
+    m_CycleDetector.clear();
+    m_TranslatedCycleDetector.clear();
+    m_State = m_Machine != nullptr ? m_Machine->getStartState() : 0;
+    m_Status = Running;
+}
+
+TMEngine::Status TMEngine::run(TMTrace *trace)
+{
+    return this->runUntil(std::numeric_limits<std::uint64_t>::max(), trace);
+}
+
+TMEngine::Status TMEngine::runUntil(std::uint64_t step, TMTrace *trace)
+{
+    if(m_Machine == nullptr || m_Machine->isEmpty())
+    {
+        m_Status = Crashed;
+        return m_Status;
+    }
+    if(m_RunAccelerated)
+        return this->runAccelerated(step);
+
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point startTime = Clock::now();
+
+    const TMCompiledMachine &machine = *m_Machine;
+    TMTape &tape = m_Tape;
+    const bool leftBounded = m_LeftBounded;
+    std::uint64_t steps = m_Steps;
+    int state = m_State;
+    Status status = Running;
+
+    //Limits of 0 are unlimited:
+    const std::uint64_t noLimit = std::numeric_limits<std::uint64_t>::max();
+    const std::uint64_t maxSteps = m_Config.getMaxSteps() > 0 ? m_Config.getMaxSteps() : noLimit;
+    const std::int64_t maxTapeCells = m_Config.getMaxTapeCells() > 0 ?
+                                          static_cast<std::int64_t>(m_Config.getMaxTapeCells()) :
+                                          std::numeric_limits<std::int64_t>::max();
+    const std::int64_t maxWallTime = m_Config.getMaxWallTime() * 1000000;
+    const std::size_t maxTraceMemory = m_Config.getMaxTraceMemory();
+    const std::uint64_t checkInterval = m_Config.getCheckInterval();
+
+    //The hot loop compares the step count against a single bound, the nearest of the step limit,
+    //the requested stop and the next wall time/trace memory check:
+    std::uint64_t nextCheck = steps + std::min(checkInterval, noLimit - steps);
+    std::uint64_t bound = std::min(std::min(maxSteps, step), nextCheck);
+
+    //An empty trace starts with a keyframe of the initial tape:
+    if(trace != nullptr && trace->isEmpty())
+        trace->begin(tape, state);
+
+    TMCycleDetector *detector = m_Config.isCycleDetectionEnabled() ? &m_CycleDetector : nullptr;
+    if(detector != nullptr && !detector->isStarted())
+        detector->begin(tape, state, steps);
+
+    TMTranslatedCycleDetector *translatedDetector = m_Config.isTranslatedCycleDetectionEnabled() ?
+                                                        &m_TranslatedCycleDetector : nullptr;
+    if(translatedDetector != nullptr && !translatedDetector->isStarted())
+        translatedDetector->begin(tape);
+
+    TMProfile *profile = m_Profile;
+    if(profile != nullptr && profile->isEmpty())
+        profile->begin(machine, tape, state);
+
+    while(status == Running)
+    {
+        //If the state is a HALT state, accept input:
+        if(machine.isHALTState(state))
+        {
+            status = Accepted;
+            break;
+        }
+
+        if(steps >= bound)
+        {
+            if(steps >= maxSteps)
+            {
+                status = StepLimitReached;
+                break;
+            }
+            if(steps >= step)
+                break;
+
+            //Periodic checks of the slower budgets:
+            std::int64_t elapsed = m_ElapsedNanoseconds +
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+            if(maxWallTime > 0 && elapsed >= maxWallTime)
+            {
+                status = TimeLimitReached;
+                break;
+            }
+            if(trace != nullptr && maxTraceMemory > 0 && trace->getMemoryUsage() >= maxTraceMemory)
+            {
+                status = TraceLimitReached;
+                break;
+            }
+            nextCheck = steps + std::min(checkInterval, noLimit - steps);
+            bound = std::min(std::min(maxSteps, step), nextCheck);
+        }
+
+        //Look up the edge for the symbol under the head:
+        TMSymbol symbol = tape.read();
+        const TMCompiledTransition &t = machine.getTransition(state, symbol);
+        if(t.nextState < 0)
+        {
+            status = Crashed;
+            break;
+        }
+
+        //Write, move and change state:
+        std::int64_t head = tape.getHeadPosition();
+        tape.write(t.write);
+        if(detector != nullptr)
+            detector->write(head, symbol, t.write);
+        tape.move(t.move);
+        steps++;
+
+        if(trace != nullptr)
+            trace->addStep(TMTraceStep{head, state, t.nextState, symbol, t.write, t.move}, tape);
+        if(profile != nullptr)
+            profile->addStep(state, symbol, head, t.move, tape);
+        state = t.nextState;
+
+        if(leftBounded && tape.getHeadPosition() < 0)
+            status = LeftEndCrash;
+        else if(tape.getRightmost() - tape.getLeftmost() >= maxTapeCells)
+            status = TapeLimitReached;
+        else if(detector != nullptr && detector->check(steps, state, tape))
+            status = CycleDetected;
+        else if(translatedDetector != nullptr && translatedDetector->check(steps, state, tape))
+            status = TranslatedCycleDetected;
+    }
+
+    if(status == CycleDetected)
+        m_CycleDetector.findCycleStart(machine);
+
+    m_Steps = steps;
+    m_State = state;
+    m_Status = status;
+    m_ElapsedNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+    if(trace != nullptr)
+        trace->finish(state);
+    if(profile != nullptr)
+        profile->finish(tape, state, m_ElapsedNanoseconds);
+    return m_Status;
+}
+
+TMEngine::Status TMEngine::runAccelerated(std::uint64_t step)
+{
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point startTime = Clock::now();
+
+    const TMCompiledMachine &machine = *m_Machine;
+    TMRunLengthTape &tape = m_RunLengthTape;
+    const bool leftBounded = m_LeftBounded;
+    std::uint64_t steps = m_Steps;
+    int state = m_State;
+    Status status = Running;
+
+    //Limits of 0 are unlimited:
+    const std::uint64_t noLimit = std::numeric_limits<std::uint64_t>::max();
+    const std::uint64_t maxSteps = m_Config.getMaxSteps() > 0 ? m_Config.getMaxSteps() : noLimit;
+    const std::int64_t maxTapeCells = m_Config.getMaxTapeCells() > 0 ?
+                                          static_cast<std::int64_t>(m_Config.getMaxTapeCells()) :
+                                          std::numeric_limits<std::int64_t>::max();
+    const std::int64_t maxWallTime = m_Config.getMaxWallTime() * 1000000;
+    const std::uint64_t checkInterval = m_Config.getCheckInterval();
+    const bool tapeLimited = m_Config.getMaxTapeCells() > 0;
+
+    std::uint64_t nextCheck = steps + std::min(checkInterval, noLimit - steps);
+    std::uint64_t bound = std::min(std::min(maxSteps, step), nextCheck);
+
+    while(status == Running)
+    {
+        //If the state is a HALT state, accept input:
+        if(machine.isHALTState(state))
+        {
+            status = Accepted;
+            break;
+        }
+
+        if(steps >= bound)
+        {
+            if(steps >= maxSteps)
+            {
+                status = StepLimitReached;
+                break;
+            }
+            if(steps >= step)
+                break;
+
+            std::int64_t elapsed = m_ElapsedNanoseconds +
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+            if(maxWallTime > 0 && elapsed >= maxWallTime)
+            {
+                status = TimeLimitReached;
+                break;
+            }
+            nextCheck = steps + std::min(checkInterval, noLimit - steps);
+            bound = std::min(std::min(maxSteps, step), nextCheck);
+        }
+
+        //Look up the edge for the symbol under the head:
+        TMSymbol symbol = tape.read();
+        const TMCompiledTransition &t = machine.getTransition(state, symbol);
+        if(t.nextState < 0)
+        {
+            status = Crashed;
+            break;
+        }
+
+        if(t.nextState == state && t.move != TMMoveStay)
+        {
+            //The transition repeats until the head leaves the run of this symbol. Stop the sweep early at
+            //the step where a limit, a left end crash or the next check would happen when stepping:
+            std::uint64_t count = std::min(tape.getRunLength(t.move), bound - steps);
+            std::int64_t head = tape.getHeadPosition();
+            if(tapeLimited && tape.getRightmost() - tape.getLeftmost() >= maxTapeCells)
+                count = 1;
+            else if(tapeLimited)
+            {
+                std::int64_t cells = t.move > 0 ? tape.getLeftmost() + maxTapeCells - head :
+                                                  head + maxTapeCells - tape.getRightmost();
+                count = std::min(count, static_cast<std::uint64_t>(cells));
+            }
+            if(leftBounded && t.move < 0)
+                count = std::min(count, static_cast<std::uint64_t>(head + 1));
+
+            tape.sweep(t.move, count, t.write);
+            steps += count;
+        }
+        else
+        {
+            //Write, move and change state:
+            tape.write(t.write);
+            tape.move(t.move);
+            steps++;
+            state = t.nextState;
+        }
+
+        if(leftBounded && tape.getHeadPosition() < 0)
+            status = LeftEndCrash;
+        else if(tape.getRightmost() - tape.getLeftmost() >= maxTapeCells)
+            status = TapeLimitReached;
+    }
+
+    m_Steps = steps;
+    m_State = state;
+    m_Status = status;
+    m_TapeStale = true;
+    m_ElapsedNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+    return m_Status;
+}
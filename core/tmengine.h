@@ -0,0 +1,109 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMENGINE_H
+#define TMENGINE_H
+
+#include "tmcompiledmachine.h"
+#include "tmcycledetector.h"
+#include "tmtranslatedcycledetector.h"
+#include "tmprofile.h"
+#include "tmtape.h"
+#include "tmrunconfig.h"
+#include "tmrunlengthtape.h"
+#include "tmtrace.h"
+#include "tmtypes.h"
+#include <cstdint>
+#include <vector>
+
+/* Runs a TMCompiledMachine over a tape of symbol ids.
+ *
+ * The run loop only does table lookups and integer arithmetic; nothing is allocated per step
+ * apart from new tape chunks and the amortized growth of the optional trace.
+ * By default the tape is bounded on the left (moving left of cell 0 crashes the machine), as
+ * in the simulator's one-way infinite tape; setLeftBounded(false) gives a two-way infinite tape.
+ * Every run is limited by a TMRunConfig; each limit has its own status so callers can tell which
+ * budget ran out. With cycle detection on, a run that repeats a configuration ends with CycleDetected
+ * and getCycleDetector() gives the cycle length and the step the cycle starts. Runs that repeat while
+ * drifting along the tape end with TranslatedCycleDetected when translated cycle detection is on.
+ *
+ * In accelerated mode the tape is run-length encoded and a transition that stays in its state and
+ * keeps moving the same way over a run of the symbol it reads is applied to the whole run at once.
+ * The final configuration and step count are the same as stepping one cell at a time, but no trace
+ * is recorded and cycle detection is not done. The tape is written out when getTape() is called;
+ * getLeftmost(), getRightmost() and read() give the visited extent and the cell under the head without
+ * writing it out.
+ *
+ * setProfile() gives the engine a TMProfile to count states, transitions and head moves in; the run
+ * loop only checks for it once per step when there is none. Accelerated runs are not profiled.
+*/
+class TMEngine
+{
+public:
+    enum Status {Running, Accepted, Crashed, LeftEndCrash,
+                 StepLimitReached, TapeLimitReached, TimeLimitReached, TraceLimitReached,
+                 CycleDetected, TranslatedCycleDetected};
+
+    //Constructor:
+    explicit TMEngine(const TMCompiledMachine *machine = nullptr);
+
+    //Accessor functions:
+    Status getStatus() const;
+    int getCurrentState() const;
+    std::int64_t getHeadPosition() const;
+    std::int64_t getLeftmost() const;
+    std::int64_t getRightmost() const;
+    TMSymbol read() const;
+    std::uint64_t getSteps() const;
+    std::int64_t getElapsedTime() const;
+    const TMTape &getTape() const;
+    std::size_t getTapeMemoryUsage() const;
+    const TMRunConfig &getRunConfig() const;
+    const TMCycleDetector &getCycleDetector() const;
+    const TMTranslatedCycleDetector &getTranslatedCycleDetector() const;
+    bool isLeftBounded() const;
+    bool isAccelerated() const;
+
+    //Mutator functions:
+    void setMachine(const TMCompiledMachine *machine);
+    void setLeftBounded(bool bounded);
+    void setRunConfig(const TMRunConfig &config);
+    void setAccelerated(bool accelerated);
+    void setProfile(TMProfile *profile);
+    void reset(const std::vector<TMSymbol> &input);
+    Status run(TMTrace *trace = nullptr);
+    Status runUntil(std::uint64_t step, TMTrace *trace = nullptr);
+
+private:
+    Status runAccelerated(std::uint64_t step);
+
+    const TMCompiledMachine *m_Machine;
+    mutable TMTape m_Tape;
+    TMRunLengthTape m_RunLengthTape;
+    TMRunConfig m_Config;
+    TMCycleDetector m_CycleDetector;
+    TMTranslatedCycleDetector m_TranslatedCycleDetector;
+    TMProfile *m_Profile;
+    std::uint64_t m_Steps;
+    std::int64_t m_ElapsedNanoseconds;
+    int m_State;
+    Status m_Status;
+    bool m_LeftBounded;
+    bool m_Accelerated;
+    bool m_RunAccelerated;
+    mutable bool m_TapeStale;
+};
+
+#endif // TMENGINE_H
@@ -0,0 +1,557 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmequivalencechecker.h"
+#include "tmlanguageenumerator.h"
+#include "tmprocessor.h"
+#include <QElapsedTimer>
+#include <QVector>
+#include <QtConcurrent>
+#include <algorithm>
+#include <limits>
+
+TMEquivalenceChecker::TMEquivalenceChecker(TuringMachine *first, TuringMachine *second):
+    m_CounterexampleRank(NoCounterexample), m_NumStrings(0), m_NumUndecided(0), m_NumSettledByPrefix(0),
+    m_TotalSteps(0), m_ElapsedTime(0), m_MaxLength(0), m_Status(Invalid), m_LeftBounded(true),
+    m_PrefixCached(false)
+{
+    m_TMs[0] = first;
+    m_TMs[1] = second;
+}
+
+TMEquivalenceChecker::Status TMEquivalenceChecker::checkUpTo(int maxLength)
+{
+    QElapsedTimer clock;
+    clock.start();
+
+    m_MaxLength = qMax(0, maxLength);
+    m_Corpus.clear();
+    if(!this->prepare(true))
+        return m_Status;
+
+    //Prefix caching needs both machines to have one tape and one edge per state and symbol:
+    m_PrefixCached = true;
+    for(TuringMachine *theTM : m_TMs)
+        if(theTM->getNumTapes() > 1 || !theTM->getCompiledMachine().isDeterministic())
+            m_PrefixCached = false;
+
+    if(!m_PrefixCached)
+    {
+        if(m_RankOffsets.back() > TMLanguageEnumerator::MaxStrings)
+        {
+            m_ErrorString = QString("There are more than %1 strings of up to %2 symbols to run without prefix caching.")
+                                .arg(TMLanguageEnumerator::MaxStrings) .arg(m_MaxLength);
+            m_Status = Invalid;
+            return m_Status;
+        }
+        this->runStrings(m_RankOffsets.back());
+        m_ElapsedTime = clock.elapsed();
+        return this->finish();
+    }
+
+    //Both machines start with the head on cell 0, the first cell that depends on the input:
+    Node root;
+    for(int i = 0; i < 2; i++)
+    {
+        Run &run = root.runs[i];
+        run.origin = 0;
+        run.head = 0;
+        run.steps = 0;
+        run.state = m_TMs[i]->getCompiledMachine().getStartState();
+        run.outcome = Running;
+    }
+
+    //Walk the top of the tree on this thread, then search the subtrees below it in parallel:
+    const int k = m_Alphabet.length();
+    int splitDepth = 0;
+    for(quint64 nodes = 1; splitDepth < m_MaxLength && k > 1 && nodes < 64; splitDepth++)
+        nodes *= quint64(k);
+
+    std::vector<Node> frontier;
+    this->search(root, &frontier, splitDepth);
+    QtConcurrent::blockingMap(frontier, SubtreeSearch{this});
+
+    m_ElapsedTime = clock.elapsed();
+    return this->finish();
+}
+
+TMEquivalenceChecker::Status TMEquivalenceChecker::checkCorpus(const QStringList &inputs)
+{
+    QElapsedTimer clock;
+    clock.start();
+
+    m_Corpus = inputs;
+    if(!this->prepare(false))
+        return m_Status;
+
+    m_PrefixCached = false;
+    this->runStrings(quint64(m_Corpus.length()));
+    m_ElapsedTime = clock.elapsed();
+    return this->finish();
+}
+
+bool TMEquivalenceChecker::prepare(bool enumerate)
+{
+    m_ErrorString = "";
+    m_Counterexample = "";
+    m_CounterexampleRank = NoCounterexample;
+    m_NumStrings = 0;
+    m_NumUndecided = 0;
+    m_NumSettledByPrefix = 0;
+    m_TotalSteps = 0;
+    m_ElapsedTime = 0;
+    m_PrefixCached = false;
+    for(int i = 0; i < 2; i++)
+    {
+        m_Outcomes[i] = "";
+        m_Traces[i] = "";
+    }
+
+    if(m_TMs[0] == nullptr || m_TMs[1] == nullptr || m_TMs[0]->getNumStates() == 0 || m_TMs[1]->getNumStates() == 0)
+    {
+        m_ErrorString = "Two TMs are needed to compare.";
+        m_Status = Invalid;
+        return false;
+    }
+
+    //Only the step budget applies (and the configuration budget of nondeterministic runs):
+    m_StepConfig = TMRunConfig();
+    m_StepConfig.setMaxSteps(m_Config.getMaxSteps());
+    m_StepConfig.setMaxTapeCells(0);
+    m_StepConfig.setMaxConfigurations(m_Config.getMaxConfigurations());
+
+    if(!enumerate)
+        return true;
+
+    //The alphabet defaults to every symbol either machine reads:
+    if(m_AlphabetOverride.isEmpty())
+        m_Alphabet = TMLanguageEnumerator::inputAlphabet(*m_TMs[0]) + TMLanguageEnumerator::inputAlphabet(*m_TMs[1]);
+    else
+        m_Alphabet = m_AlphabetOverride;
+    m_Alphabet.removeDuplicates();
+
+    //Symbols a machine has no edge for all map onto its undefined column:
+    for(int i = 0; i < 2; i++)
+    {
+        const TMSymbolTable &symbols = m_TMs[i]->getSymbolTable();
+        m_AlphabetIds[i].clear();
+        for(const QString &symbol : m_Alphabet)
+        {
+            int id = symbols.find(symbol.toStdString());
+            m_AlphabetIds[i].push_back(static_cast<TMSymbol>(id >= 0 ? id : symbols.getNumSymbols()));
+        }
+    }
+
+    //m_RankOffsets[n] is the number of strings shorter than n, m_SubtreeSizes[n] the number of strings
+    //of up to m_MaxLength symbols below a prefix of n symbols:
+    const quint64 k = quint64(m_Alphabet.length());
+    const quint64 maxCount = std::numeric_limits<quint64>::max() / 2;
+    m_RankOffsets.assign(1, 0);
+    std::vector<quint64> powers(1, 1);
+    for(int length = 0; length <= m_MaxLength; length++)
+    {
+        if(k > 1 && powers.back() > maxCount / k)
+        {
+            m_ErrorString = QString("There are too many strings of up to %1 symbols.") .arg(m_MaxLength);
+            m_Status = Invalid;
+            return false;
+        }
+        m_RankOffsets.push_back(m_RankOffsets.back() + powers.back());
+        powers.push_back(powers.back() * k);
+    }
+    m_SubtreeSizes.assign(m_MaxLength + 1, 0);
+    for(int depth = m_MaxLength; depth >= 0; depth--)
+        m_SubtreeSizes[depth] = 1 + (depth < m_MaxLength ? k * m_SubtreeSizes[depth + 1] : 0);
+    return true;
+}
+
+void TMEquivalenceChecker::search(Node &node, std::vector<Node> *frontier, int splitDepth)
+{
+    //The prefix comes first in its subtree, so nothing below can beat a counterexample before it:
+    if(this->rank(node.prefix) >= m_CounterexampleRank)
+        return;
+
+    const int depth = static_cast<int>(node.prefix.size());
+    if(frontier != nullptr && depth == splitDepth)
+    {
+        frontier->push_back(node);
+        return;
+    }
+
+    //Both machines stopped before reading past the prefix, so every string below agrees or disagrees alike:
+    if(node.runs[0].outcome != Running && node.runs[1].outcome != Running)
+    {
+        m_NumSettledByPrefix += m_SubtreeSizes[depth] - 1;
+        if(this->compare(node.runs[0].outcome, node.runs[1].outcome, m_SubtreeSizes[depth]))
+            this->found(this->rank(node.prefix), this->toString(node.prefix));
+        return;
+    }
+
+    //The prefix on its own is followed by blanks:
+    Outcome ends[2];
+    for(int i = 0; i < 2; i++)
+    {
+        ends[i] = node.runs[i].outcome;
+        if(ends[i] == Running)
+        {
+            Run run = node.runs[i];
+            writeCell(run, run.head, 0);
+            this->advance(run, m_TMs[i]->getCompiledMachine(), std::numeric_limits<std::int64_t>::min());
+            ends[i] = run.outcome;
+        }
+    }
+    if(this->compare(ends[0], ends[1], 1))
+        this->found(this->rank(node.prefix), this->toString(node.prefix));
+    if(depth == m_MaxLength)
+        return;
+
+    //Each child writes its symbol under the head and runs on until the head reaches the next cell:
+    Node child;
+    child.prefix = node.prefix;
+    child.prefix.push_back(0);
+    for(int symbol = 0; symbol < m_Alphabet.length(); symbol++)
+    {
+        child.prefix.back() = symbol;
+        for(int i = 0; i < 2; i++)
+        {
+            child.runs[i] = node.runs[i];
+            Run &run = child.runs[i];
+            if(run.outcome == Running)
+            {
+                writeCell(run, run.head, m_AlphabetIds[i][symbol]);
+                this->advance(run, m_TMs[i]->getCompiledMachine(), depth + 1);
+            }
+        }
+        this->search(child, frontier, splitDepth);
+    }
+}
+
+void TMEquivalenceChecker::advance(Run &run, const TMCompiledMachine &machine, std::int64_t boundary)
+{
+    //The same order of checks as TMEngine::runUntil(), pausing when the head reaches the boundary:
+    const std::uint64_t maxSteps = m_StepConfig.getMaxSteps() > 0 ? m_StepConfig.getMaxSteps()
+                                                                   : std::numeric_limits<std::uint64_t>::max();
+    const std::uint64_t startSteps = run.steps;
+    while(true)
+    {
+        if(machine.isHALTState(run.state))
+        {
+            run.outcome = Accepted;
+            break;
+        }
+        if(run.steps >= maxSteps)
+        {
+            run.outcome = Undecided;
+            break;
+        }
+
+        const TMCompiledTransition &t = machine.getTransition(run.state, readCell(run, run.head));
+        if(t.nextState < 0)
+        {
+            run.outcome = Rejected;
+            break;
+        }
+        writeCell(run, run.head, t.write);
+        run.head += t.move;
+        run.state = t.nextState;
+        run.steps++;
+
+        if(m_LeftBounded && run.head < 0)
+        {
+            run.outcome = Rejected;
+            break;
+        }
+        if(run.head == boundary)
+            break;
+    }
+    m_TotalSteps += run.steps - startSteps;
+}
+
+TMSymbol TMEquivalenceChecker::readCell(const Run &run, std::int64_t position)
+{
+    std::int64_t index = position + run.origin;
+    if(index < 0 || index >= static_cast<std::int64_t>(run.cells.size()))
+        return 0;
+    return run.cells[static_cast<std::size_t>(index)];
+}
+
+void TMEquivalenceChecker::writeCell(Run &run, std::int64_t position, TMSymbol symbol)
+{
+    //Grow by at least the current size on either side, so that sweeps stay amortized:
+    std::int64_t index = position + run.origin;
+    if(index < 0)
+    {
+        std::int64_t grow = std::max<std::int64_t>(-index, static_cast<std::int64_t>(run.cells.size()));
+        run.cells.insert(run.cells.begin(), static_cast<std::size_t>(grow), 0);
+        run.origin += grow;
+        index += grow;
+    }
+    else if(index >= static_cast<std::int64_t>(run.cells.size()))
+        run.cells.resize(static_cast<std::size_t>(index) + 1, 0);
+    run.cells[static_cast<std::size_t>(index)] = symbol;
+}
+
+TMEquivalenceChecker::Status TMEquivalenceChecker::runStrings(quint64 count)
+{
+    QVector<StringBlock> blocks;
+    const quint64 blockSize = 256;
+    for(quint64 first = 0; first < count; first += blockSize)
+        blocks.append(StringBlock{first, qMin(blockSize, count - first)});
+    QtConcurrent::blockingMap(blocks, BlockSearch{this});
+    return m_Status;
+}
+
+void TMEquivalenceChecker::runBlock(const StringBlock &block)
+{
+    //One processor per machine for the whole block:
+    TMProcessor first(nullptr);
+    TMProcessor second(nullptr);
+    TMProcessor *processors[2] = {&first, &second};
+    for(int i = 0; i < 2; i++)
+    {
+        processors[i]->setRecordingEnabled(false);
+        processors[i]->setLeftBounded(m_LeftBounded);
+        processors[i]->setRunConfig(m_StepConfig);
+        processors[i]->setExecutionMode(m_TMs[i]->getNumTapes() == 1 && !m_TMs[i]->getCompiledMachine().isDeterministic()
+                                           ? TMProcessor::Nondeterministic : TMProcessor::Compiled);
+    }
+
+    for(quint64 rank = block.first; rank < block.first + block.count && rank < m_CounterexampleRank; rank++)
+    {
+        QString input = this->stringAt(rank);
+        Outcome outcomes[2];
+        for(int i = 0; i < 2; i++)
+        {
+            processors[i]->setParameters(input + '-', m_TMs[i]);
+            TMProcessor::ProcessResult result = processors[i]->start();
+            m_TotalSteps += processors[i]->getSteps();
+            if(result != TMProcessor::Successful)
+                outcomes[i] = Undecided;
+            else
+                outcomes[i] = processors[i]->getCrashString() == "" ? Accepted : Rejected;
+        }
+        if(this->compare(outcomes[0], outcomes[1], 1))
+            this->found(rank, input);
+    }
+}
+
+bool TMEquivalenceChecker::compare(Outcome first, Outcome second, quint64 strings)
+{
+    m_NumStrings += strings;
+    if(first == Undecided || second == Undecided)
+    {
+        m_NumUndecided += strings;
+        return false;
+    }
+    return first != second;
+}
+
+void TMEquivalenceChecker::found(quint64 rank, const QString &input)
+{
+    //Keep the first counterexample in order:
+    QMutexLocker locker(&m_FoundMutex);
+    if(rank < m_CounterexampleRank)
+    {
+        m_CounterexampleRank = rank;
+        m_Counterexample = input;
+    }
+}
+
+TMEquivalenceChecker::Status TMEquivalenceChecker::finish()
+{
+    if(m_CounterexampleRank != NoCounterexample)
+    {
+        m_Status = CounterexampleFound;
+        this->recordTraces();
+    }
+    else
+        m_Status = m_NumUndecided > 0 ? Inconclusive : Equivalent;
+    return m_Status;
+}
+
+quint64 TMEquivalenceChecker::rank(const std::vector<int> &symbols) const
+{
+    quint64 index = 0;
+    for(int symbol : symbols)
+        index = index * quint64(m_Alphabet.length()) + quint64(symbol);
+    return m_RankOffsets[symbols.size()] + index;
+}
+
+QString TMEquivalenceChecker::toString(const std::vector<int> &symbols) const
+{
+    //Symbols longer than one character are separated by spaces so that the string tokenizes back the same way:
+    bool separate = false;
+    for(const QString &symbol : m_Alphabet)
+        if(symbol.length() > 1)
+            separate = true;
+
+    QStringList names;
+    for(int symbol : symbols)
+        names.append(m_Alphabet[symbol]);
+    return names.join(separate ? " " : "");
+}
+
+QString TMEquivalenceChecker::stringAt(quint64 rank) const
+{
+    if(!m_Corpus.isEmpty())
+        return m_Corpus[int(rank)];
+
+    //Find the length, then the digits of the index within that length:
+    int length = 0;
+    while(m_RankOffsets[length + 1] <= rank)
+        length++;
+    quint64 index = rank - m_RankOffsets[length];
+    std::vector<int> symbols(length, 0);
+    for(int i = length - 1; i >= 0; i--)
+    {
+        symbols[i] = int(index % quint64(m_Alphabet.length()));
+        index /= quint64(m_Alphabet.length());
+    }
+    return this->toString(symbols);
+}
+
+void TMEquivalenceChecker::recordTraces()
+{
+    for(int i = 0; i < 2; i++)
+    {
+        const bool nondeterministic = m_TMs[i]->getNumTapes() == 1 && !m_TMs[i]->getCompiledMachine().isDeterministic();
+        TMProcessor processor(nullptr);
+        processor.setLeftBounded(m_LeftBounded);
+        processor.setRunConfig(m_StepConfig);
+        processor.setExecutionMode(nondeterministic ? TMProcessor::Nondeterministic : TMProcessor::Compiled);
+        processor.setParameters(m_Counterexample + '-', m_TMs[i]);
+
+        //The full run only gives the outcome. The accepting branch of a nondeterministic run is kept by the runner anyway:
+        processor.setRecordingEnabled(nondeterministic);
+        TMProcessor::ProcessResult result = processor.start();
+        const quint64 steps = processor.getSteps();
+
+        if(result != TMProcessor::Successful)
+            m_Outcomes[i] = QString("LIMIT after %1 steps: %2") .arg(steps) .arg(processor.getLimitString(result));
+        else if(processor.getCrashString() == "")
+            m_Outcomes[i] = QString("ACCEPTED after %1 steps") .arg(steps);
+        else
+            m_Outcomes[i] = QString("CRASHED after %1 steps: %2") .arg(steps) .arg(processor.getCrashString());
+
+        //Run again for the printed prefix only, so a long run does not record a trace nobody sees:
+        if(!nondeterministic && m_TMs[i]->getNumTapes() == 1 && steps > 0)
+        {
+            TMRunConfig prefixConfig = m_StepConfig;
+            prefixConfig.setMaxSteps(MaxTraceLines);
+            processor.setRunConfig(prefixConfig);
+            processor.setRecordingEnabled(true);
+            processor.start();
+        }
+
+        //One line per step: step, state, read, write, move and next state:
+        const TMTrace &trace = processor.getTrace();
+        QStringList lines;
+        for(quint64 step = 0; step < trace.getNumSteps() && step < MaxTraceLines; step++)
+        {
+            const TMTraceStep &s = trace.getStep(step);
+            lines.append(QString("%1\t%2\t%3 -> %4\t%5\t%6") .arg(step + 1) .arg(processor.getStateName(s.fromState))
+                             .arg(processor.getSymbolName(s.oldSymbol), processor.getSymbolName(s.newSymbol))
+                             .arg(s.move < 0 ? "L" : s.move > 0 ? "R" : "S") .arg(processor.getStateName(s.toState)));
+        }
+        if(!trace.isEmpty() && steps > MaxTraceLines)
+            lines.append(QString("... %1 more steps") .arg(steps - MaxTraceLines));
+        if(trace.isEmpty() && m_TMs[i]->getNumTapes() > 1)
+            lines.append("(multi-tape runs record no trace)");
+        else if(trace.isEmpty() && steps > 0)
+            lines.append("(no branch halted, so there is no single branch to trace)");
+        m_Traces[i] = lines.join('\n');
+    }
+}
+
+TMEquivalenceChecker::Status TMEquivalenceChecker::getStatus() const
+{
+    return m_Status;
+}
+
+QString TMEquivalenceChecker::getCounterexample() const
+{
+    return m_Counterexample;
+}
+
+QString TMEquivalenceChecker::getOutcome(int machine) const
+{
+    return m_Outcomes[machine];
+}
+
+QString TMEquivalenceChecker::getTrace(int machine) const
+{
+    return m_Traces[machine];
+}
+
+const QStringList &TMEquivalenceChecker::getAlphabet() const
+{
+    return m_Alphabet;
+}
+
+QString TMEquivalenceChecker::getErrorString() const
+{
+    return m_ErrorString;
+}
+
+quint64 TMEquivalenceChecker::getNumStrings() const
+{
+    return m_NumStrings;
+}
+
+quint64 TMEquivalenceChecker::getNumUndecided() const
+{
+    return m_NumUndecided;
+}
+
+quint64 TMEquivalenceChecker::getNumSettledByPrefix() const
+{
+    return m_NumSettledByPrefix;
+}
+
+quint64 TMEquivalenceChecker::getTotalSteps() const
+{
+    return m_TotalSteps;
+}
+
+qint64 TMEquivalenceChecker::getElapsedTime() const
+{
+    return m_ElapsedTime;
+}
+
+bool TMEquivalenceChecker::isPrefixCached() const
+{
+    return m_PrefixCached;
+}
+
+void TMEquivalenceChecker::setMachines(TuringMachine *first, TuringMachine *second)
+{
+    m_TMs[0] = first;
+    m_TMs[1] = second;
+}
+
+void TMEquivalenceChecker::setAlphabet(const QStringList &alphabet)
+{
+    m_AlphabetOverride = alphabet;
+}
+
+void TMEquivalenceChecker::setLeftBounded(bool bounded)
+{
+    m_LeftBounded = bounded;
+}
+
+void TMEquivalenceChecker::setRunConfig(const TMRunConfig &config)
+{
+    m_Config = config;
+}
@@ -0,0 +1,166 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMEQUIVALENCECHECKER_H
+#define TMEQUIVALENCECHECKER_H
+
+#include "tmrunconfig.h"
+#include "tmtypes.h"
+#include "turingmachine.h"
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/* Checks that two built TuringMachines accept the same strings, either every string up to a length
+ * or a given corpus, and stops at the first string they disagree on.
+ *
+ * Only the step budget of the TMRunConfig applies, so that a run does not depend on anything but the
+ * machine and its input. A string counts as undecided when either machine runs out of steps on it.
+ *
+ * Up to a length, two deterministic single-tape machines are run over the tree of strings with their
+ * shared prefixes cached. Every string with prefix P runs exactly the same way until the head first
+ * reaches the cell after P, so each node of the tree keeps the configuration of both machines at that
+ * moment and its children carry on from there. A machine that halts or crashes before reaching that
+ * cell has the same outcome for the whole subtree, which is then settled without running it. The tree
+ * is split at a shallow depth and the subtrees are searched on the global thread pool.
+ *
+ * Nondeterministic and multi-tape machines, and corpora, are run string by string through
+ * TMProcessor on the thread pool instead.
+ *
+ * Strings are ordered shortest first, then by the order of the alphabet (corpora keep their own order).
+ * Once a counterexample is found, only strings before it are still run, so the one reported is always
+ * the first in that order whatever the number of threads. Both machines are then run on it again to
+ * record their traces.
+*/
+class TMEquivalenceChecker
+{
+public:
+    enum Status {Equivalent, CounterexampleFound, Inconclusive, Invalid};
+
+    //Trace lines past this are left out:
+    enum {MaxTraceLines = 2000};
+
+    //Constructor:
+    TMEquivalenceChecker(TuringMachine *first = nullptr, TuringMachine *second = nullptr);
+
+    //Accessor functions:
+    Status getStatus() const;
+    QString getCounterexample() const;
+    QString getOutcome(int machine) const;
+    QString getTrace(int machine) const;
+    const QStringList &getAlphabet() const;
+    QString getErrorString() const;
+    quint64 getNumStrings() const;
+    quint64 getNumUndecided() const;
+    quint64 getNumSettledByPrefix() const;
+    quint64 getTotalSteps() const;
+    qint64 getElapsedTime() const;
+    bool isPrefixCached() const;
+
+    //Mutator functions:
+    void setMachines(TuringMachine *first, TuringMachine *second);
+    void setAlphabet(const QStringList &alphabet);
+    void setLeftBounded(bool bounded);
+    void setRunConfig(const TMRunConfig &config);
+    Status checkUpTo(int maxLength);
+    Status checkCorpus(const QStringList &inputs);
+
+private:
+    enum Outcome {Running, Accepted, Rejected, Undecided};
+    static constexpr quint64 NoCounterexample = ~quint64(0);
+
+    //One machine's configuration when its head first reaches the cell after the node's prefix:
+    struct Run
+    {
+        std::vector<TMSymbol> cells;
+        std::int64_t origin;
+        std::int64_t head;
+        std::uint64_t steps;
+        int state;
+        Outcome outcome;
+    };
+
+    struct Node
+    {
+        Run runs[2];
+        std::vector<int> prefix;
+    };
+
+    //Strings [first, first + count) in the order of checkUpTo() or checkCorpus():
+    struct StringBlock
+    {
+        quint64 first;
+        quint64 count;
+    };
+
+    //The map functors for QtConcurrent::blockingMap():
+    struct SubtreeSearch
+    {
+        TMEquivalenceChecker *checker;
+        void operator()(Node &node) const { checker->search(node, nullptr, -1); }
+    };
+
+    struct BlockSearch
+    {
+        TMEquivalenceChecker *checker;
+        void operator()(const StringBlock &block) const { checker->runBlock(block); }
+    };
+
+    bool prepare(bool enumerate);
+    void search(Node &node, std::vector<Node> *frontier, int splitDepth);
+    void advance(Run &run, const TMCompiledMachine &machine, std::int64_t boundary);
+    void runBlock(const StringBlock &block);
+    Status runStrings(quint64 count);
+    Status finish();
+    bool compare(Outcome first, Outcome second, quint64 strings);
+    void found(quint64 rank, const QString &input);
+    quint64 rank(const std::vector<int> &symbols) const;
+    QString toString(const std::vector<int> &symbols) const;
+    QString stringAt(quint64 rank) const;
+    void recordTraces();
+
+    static TMSymbol readCell(const Run &run, std::int64_t position);
+    static void writeCell(Run &run, std::int64_t position, TMSymbol symbol);
+
+    TuringMachine *m_TMs[2];
+    TMRunConfig m_Config;
+    TMRunConfig m_StepConfig;
+    QStringList m_AlphabetOverride;
+    QStringList m_Alphabet;
+    QStringList m_Corpus;
+    std::vector<TMSymbol> m_AlphabetIds[2];
+    std::vector<quint64> m_SubtreeSizes;
+    std::vector<quint64> m_RankOffsets;
+    QString m_Counterexample;
+    QString m_Outcomes[2];
+    QString m_Traces[2];
+    QString m_ErrorString;
+    QMutex m_FoundMutex;
+    std::atomic<quint64> m_CounterexampleRank;
+    std::atomic<quint64> m_NumStrings;
+    std::atomic<quint64> m_NumUndecided;
+    std::atomic<quint64> m_NumSettledByPrefix;
+    std::atomic<quint64> m_TotalSteps;
+    qint64 m_ElapsedTime;
+    int m_MaxLength;
+    Status m_Status;
+    bool m_LeftBounded;
+    bool m_PrefixCached;
+};
+
+#endif // TMEQUIVALENCECHECKER_H
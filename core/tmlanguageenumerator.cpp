@@ -0,0 +1,413 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmlanguageenumerator.h"
+#include "tmengine.h"
+#include "tmmultitapeengine.h"
+#include "tmnondeterministicrunner.h"
+#include <QtConcurrent>
+#include <algorithm>
+#include <memory>
+
+TMLanguageEnumerator::TMLanguageEnumerator(QObject *parent):
+    QObject(parent), m_TM(nullptr), m_Done(0), m_CancelRequested(false), m_NumStrings(0), m_ElapsedTime(0),
+    m_MaxLength(0), m_LeftBounded(true)
+{
+    m_Watcher = new QFutureWatcher<void>(this);
+    connect(m_Watcher, SIGNAL(progressValueChanged(int)), this, SLOT(workerProgress()));
+    connect(m_Watcher, SIGNAL(finished()), this, SLOT(workerFinished()));
+}
+
+TMLanguageEnumerator::~TMLanguageEnumerator()
+{
+    //The shards read the machine, so let them finish first:
+    this->cancel();
+    m_Watcher->waitForFinished();
+}
+
+bool TMLanguageEnumerator::run()
+{
+    if(this->isRunning() || !this->prepare())
+        return false;
+
+    QtConcurrent::map(m_Shards, ShardRunner{this}).waitForFinished();
+    m_ElapsedTime = m_Clock.elapsed();
+    return true;
+}
+
+bool TMLanguageEnumerator::startAsync()
+{
+    if(this->isRunning() || !this->prepare())
+        return false;
+
+    m_Watcher->setFuture(QtConcurrent::map(m_Shards, ShardRunner{this}));
+    return true;
+}
+
+void TMLanguageEnumerator::cancel()
+{
+    //Shards stop after the string they are running; the rest are skipped:
+    m_CancelRequested = true;
+    m_Watcher->cancel();
+}
+
+void TMLanguageEnumerator::workerProgress()
+{
+    emit this->progress(m_Done, m_NumStrings);
+}
+
+void TMLanguageEnumerator::workerFinished()
+{
+    m_ElapsedTime = m_Clock.elapsed();
+    emit this->progress(m_Done, m_NumStrings);
+    emit this->finished();
+}
+
+bool TMLanguageEnumerator::prepare()
+{
+    m_ErrorString = "";
+    m_Counts.clear();
+    m_Accepted.clear();
+    m_Undecided.clear();
+    m_Shards.clear();
+    m_Done = 0;
+    m_CancelRequested = false;
+    m_ElapsedTime = 0;
+
+    if(m_TM == nullptr || m_TM->getNumStates() == 0)
+    {
+        m_ErrorString = "There is no TM to run.";
+        return false;
+    }
+
+    //Map the alphabet to symbol ids. Symbols no edge reads get ids past the end of the table:
+    m_Alphabet = m_AlphabetOverride.isEmpty() ? inputAlphabet(*m_TM) : m_AlphabetOverride;
+    m_Alphabet.removeDuplicates();
+    m_AlphabetIds.clear();
+    const TMSymbolTable &symbols = m_TM->getSymbolTable();
+    int extra = 0;
+    for(const QString &symbol : m_Alphabet)
+    {
+        int id = symbols.find(symbol.toStdString());
+        m_AlphabetIds.push_back(static_cast<TMSymbol>(id >= 0 ? id : symbols.getNumSymbols() + extra++));
+    }
+
+    m_NumStrings = countStrings(m_Alphabet.length(), m_MaxLength);
+    if(m_NumStrings > MaxStrings)
+    {
+        m_ErrorString = QString("There are more than %1 strings of up to %2 symbols over %3 symbols.")
+                            .arg(MaxStrings) .arg(m_MaxLength) .arg(m_Alphabet.length());
+        return false;
+    }
+
+    //One bitset pair per length, and shards of at least ShardSize strings with a common prefix:
+    const quint64 k = quint64(m_Alphabet.length());
+    quint64 strings = 1;
+    for(int length = 0; length <= m_MaxLength; length++)
+    {
+        m_Counts.append(LengthCounts{strings, 0, 0, 0});
+        m_Accepted.emplace_back((strings + 63) / 64, 0);
+        m_Undecided.emplace_back((strings + 63) / 64, 0);
+
+        quint64 shardSize = 1;
+        for(int suffix = 0; suffix < length && shardSize < ShardSize; suffix++)
+            shardSize *= k;
+        for(quint64 first = 0; first < strings; first += shardSize)
+            m_Shards.append(Shard{length, first, qMin(shardSize, strings - first)});
+
+        if(k == 0)
+            break;
+        strings *= k;
+    }
+
+    m_Clock.start();
+    return true;
+}
+
+void TMLanguageEnumerator::runShard(const Shard &shard)
+{
+    const int k = m_Alphabet.length();
+    const bool multiTape = m_TM->getNumTapes() > 1;
+    const bool deterministic = multiTape || m_TM->getCompiledMachine().isDeterministic();
+
+    //One engine per shard, reset for every string:
+    std::unique_ptr<TMEngine> engine;
+    std::unique_ptr<TMMultiTapeEngine> multiTapeEngine;
+    std::unique_ptr<TMNondeterministicRunner> runner;
+    if(multiTape)
+    {
+        multiTapeEngine.reset(new TMMultiTapeEngine(&m_TM->getMultiTapeMachine()));
+        multiTapeEngine->setRunConfig(m_Config);
+        multiTapeEngine->setLeftBounded(m_LeftBounded);
+    }
+    else if(deterministic)
+    {
+        engine.reset(new TMEngine(&m_TM->getCompiledMachine()));
+        engine->setRunConfig(m_Config);
+        engine->setLeftBounded(m_LeftBounded);
+    }
+    else
+    {
+        runner.reset(new TMNondeterministicRunner(&m_TM->getCompiledMachine()));
+        runner->setRunConfig(m_Config);
+        runner->setLeftBounded(m_LeftBounded);
+    }
+
+    //The digits of the first string, most significant first:
+    std::vector<int> digits(shard.length, 0);
+    quint64 index = shard.first;
+    for(int i = shard.length - 1; i >= 0; i--)
+    {
+        digits[i] = int(index % quint64(k));
+        index /= quint64(k);
+    }
+
+    std::vector<TMSymbol> input(shard.length);
+    std::vector<quint64> accepted;
+    std::vector<quint64> undecided;
+    quint64 rejected = 0;
+    quint64 done = 0;
+    for(; done < shard.count && !m_CancelRequested; done++)
+    {
+        for(int i = 0; i < shard.length; i++)
+            input[i] = m_AlphabetIds[digits[i]];
+
+        //Sort the run into accepted, rejected (every branch crashed) or undecided (a budget ran out):
+        bool isAccepted = false;
+        bool isRejected = false;
+        if(runner)
+        {
+            TMNondeterministicRunner::Status status = runner->run(input, &m_CancelRequested);
+            isAccepted = status == TMNondeterministicRunner::Accepted;
+            isRejected = status == TMNondeterministicRunner::Rejected;
+        }
+        else
+        {
+            TMEngine::Status status;
+            if(multiTape)
+            {
+                multiTapeEngine->reset(input);
+                status = multiTapeEngine->run();
+            }
+            else
+            {
+                engine->reset(input);
+                status = engine->run();
+            }
+            isAccepted = status == TMEngine::Accepted;
+            isRejected = status == TMEngine::Crashed || status == TMEngine::LeftEndCrash;
+        }
+
+        if(isAccepted)
+            accepted.push_back(shard.first + done);
+        else if(isRejected)
+            rejected++;
+        else
+            undecided.push_back(shard.first + done);
+
+        //Next string, like an odometer:
+        for(int i = shard.length - 1; i >= 0; i--)
+        {
+            if(++digits[i] < k)
+                break;
+            digits[i] = 0;
+        }
+    }
+
+    //Strings cut off by a cancel count as neither accepted nor rejected:
+    QMutexLocker locker(&m_ResultMutex);
+    LengthCounts &counts = m_Counts[shard.length];
+    counts.accepted += accepted.size();
+    counts.rejected += rejected;
+    counts.undecided += undecided.size();
+    for(quint64 i : accepted)
+        m_Accepted[shard.length][i / 64] |= quint64(1) << (i % 64);
+    for(quint64 i : undecided)
+        m_Undecided[shard.length][i / 64] |= quint64(1) << (i % 64);
+    m_Done += done;
+}
+
+QStringList TMLanguageEnumerator::getStrings(const std::vector<std::vector<quint64>> &bits, int length, int maxStrings) const
+{
+    QStringList strings;
+    if(length < 0 || length >= int(bits.size()))
+        return strings;
+
+    const std::vector<quint64> &words = bits[length];
+    for(quint64 word = 0; word < words.size(); word++)
+    {
+        if(words[word] == 0)
+            continue;
+        for(int bit = 0; bit < 64; bit++)
+        {
+            if(((words[word] >> bit) & 1) == 0)
+                continue;
+            if(maxStrings >= 0 && strings.length() >= maxStrings)
+                return strings;
+            strings.append(this->getString(length, word * 64 + quint64(bit)));
+        }
+    }
+    return strings;
+}
+
+const QStringList &TMLanguageEnumerator::getAlphabet() const
+{
+    return m_Alphabet;
+}
+
+int TMLanguageEnumerator::getMaxLength() const
+{
+    return m_MaxLength;
+}
+
+quint64 TMLanguageEnumerator::getNumStrings() const
+{
+    return m_NumStrings;
+}
+
+quint64 TMLanguageEnumerator::getNumDone() const
+{
+    return m_Done;
+}
+
+const QVector<TMLanguageEnumerator::LengthCounts> &TMLanguageEnumerator::getCounts() const
+{
+    return m_Counts;
+}
+
+bool TMLanguageEnumerator::isAccepted(int length, quint64 index) const
+{
+    if(length < 0 || length >= int(m_Accepted.size()) || index / 64 >= m_Accepted[length].size())
+        return false;
+    return (m_Accepted[length][index / 64] >> (index % 64)) & 1;
+}
+
+bool TMLanguageEnumerator::isUndecided(int length, quint64 index) const
+{
+    if(length < 0 || length >= int(m_Undecided.size()) || index / 64 >= m_Undecided[length].size())
+        return false;
+    return (m_Undecided[length][index / 64] >> (index % 64)) & 1;
+}
+
+QString TMLanguageEnumerator::getString(int length, quint64 index) const
+{
+    //Symbols longer than one character are separated by spaces so that the string tokenizes back the same way:
+    bool separate = false;
+    for(const QString &symbol : m_Alphabet)
+        if(symbol.length() > 1)
+            separate = true;
+
+    QStringList symbols;
+    for(int i = 0; i < length; i++)
+    {
+        symbols.prepend(m_Alphabet.value(int(index % quint64(m_Alphabet.length()))));
+        index /= quint64(m_Alphabet.length());
+    }
+    return symbols.join(separate ? " " : "");
+}
+
+QStringList TMLanguageEnumerator::getAcceptedStrings(int length, int maxStrings) const
+{
+    return this->getStrings(m_Accepted, length, maxStrings);
+}
+
+QStringList TMLanguageEnumerator::getUndecidedStrings(int length, int maxStrings) const
+{
+    return this->getStrings(m_Undecided, length, maxStrings);
+}
+
+QString TMLanguageEnumerator::getErrorString() const
+{
+    return m_ErrorString;
+}
+
+qint64 TMLanguageEnumerator::getElapsedTime() const
+{
+    return m_ElapsedTime;
+}
+
+bool TMLanguageEnumerator::isRunning() const
+{
+    return m_Watcher->isRunning();
+}
+
+bool TMLanguageEnumerator::wasCancelled() const
+{
+    return m_CancelRequested;
+}
+
+quint64 TMLanguageEnumerator::countStrings(int alphabetSize, int maxLength)
+{
+    //Stops counting past MaxStrings so that large alphabets cannot overflow:
+    quint64 total = 0;
+    quint64 strings = 1;
+    for(int length = 0; length <= maxLength; length++)
+    {
+        total += strings;
+        if(total > MaxStrings)
+            return MaxStrings + 1;
+        if(alphabetSize == 0)
+            break;
+        strings *= quint64(alphabetSize);
+    }
+    return total;
+}
+
+QStringList TMLanguageEnumerator::inputAlphabet(const TuringMachine &theTM)
+{
+    //Every symbol read on the first tape except blank, in symbol id order:
+    const TMSymbolTable &symbols = theTM.getSymbolTable();
+    std::vector<int> ids;
+    for(const TMStateDescription &state : theTM.getDescription().getStates())
+    {
+        for(const TMTransitionDescription &transition : state.transitions)
+        {
+            int id = symbols.find(transition.read.value(0).toStdString());
+            if(id > 0 && std::find(ids.begin(), ids.end(), id) == ids.end())
+                ids.push_back(id);
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+
+    QStringList alphabet;
+    for(int id : ids)
+        alphabet.append(QString::fromStdString(symbols.getName(static_cast<TMSymbol>(id))));
+    return alphabet;
+}
+
+void TMLanguageEnumerator::setMachine(TuringMachine *theTM)
+{
+    m_TM = theTM;
+}
+
+void TMLanguageEnumerator::setAlphabet(const QStringList &alphabet)
+{
+    m_AlphabetOverride = alphabet;
+}
+
+void TMLanguageEnumerator::setMaxLength(int length)
+{
+    m_MaxLength = qMax(0, length);
+}
+
+void TMLanguageEnumerator::setLeftBounded(bool bounded)
+{
+    m_LeftBounded = bounded;
+}
+
+void TMLanguageEnumerator::setRunConfig(const TMRunConfig &config)
+{
+    m_Config = config;
+}
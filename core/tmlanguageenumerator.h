@@ -0,0 +1,148 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMLANGUAGEENUMERATOR_H
+#define TMLANGUAGEENUMERATOR_H
+
+#include "tmrunconfig.h"
+#include "tmtypes.h"
+#include "turingmachine.h"
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QMutex>
+#include <QObject>
+#include <QStringList>
+#include <QVector>
+#include <atomic>
+#include <vector>
+
+/* Runs every string over an input alphabet up to a maximum length on one built TuringMachine.
+ *
+ * The alphabet defaults to the symbols the machine reads on its first tape, blank excluded, in symbol
+ * id order. Strings of one length are numbered in lexicographic order of that alphabet, and the
+ * accepted and undecided strings of each length are kept as bitsets over those numbers, so a result
+ * set takes one bit per string; getString() turns a number back into its string.
+ *
+ * The work is split into shards by prefix: each shard holds every string of one length that starts
+ * with the same prefix, a contiguous block of at least ShardSize strings where the length allows it.
+ * Shards run on the global thread pool with QtConcurrent::map(), each with its own engine over the
+ * shared machine. Every string gets the full TMRunConfig budget; runs that end on a limit or a
+ * detected cycle count as undecided. Nondeterministic machines run every string through
+ * TMNondeterministicRunner, which also spreads each search over the thread pool.
+*/
+class TMLanguageEnumerator : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum {ShardSize = 1024};
+
+    //At most 2^30 strings, so the two bitsets take no more than 256 MB:
+    static constexpr quint64 MaxStrings = quint64(1) << 30;
+
+    struct LengthCounts
+    {
+        quint64 strings;
+        quint64 accepted;
+        quint64 rejected;
+        quint64 undecided;
+    };
+
+    //Constructor and destructor:
+    explicit TMLanguageEnumerator(QObject *parent = nullptr);
+    ~TMLanguageEnumerator();
+
+    //Accessor functions:
+    const QStringList &getAlphabet() const;
+    int getMaxLength() const;
+    quint64 getNumStrings() const;
+    quint64 getNumDone() const;
+    const QVector<LengthCounts> &getCounts() const;
+    bool isAccepted(int length, quint64 index) const;
+    bool isUndecided(int length, quint64 index) const;
+    QString getString(int length, quint64 index) const;
+    QStringList getAcceptedStrings(int length, int maxStrings = -1) const;
+    QStringList getUndecidedStrings(int length, int maxStrings = -1) const;
+    QString getErrorString() const;
+    qint64 getElapsedTime() const;
+    bool isRunning() const;
+    bool wasCancelled() const;
+
+    static quint64 countStrings(int alphabetSize, int maxLength);
+    static QStringList inputAlphabet(const TuringMachine &theTM);
+
+    //Mutator functions:
+    void setMachine(TuringMachine *theTM);
+    void setAlphabet(const QStringList &alphabet);
+    void setMaxLength(int length);
+    void setLeftBounded(bool bounded);
+    void setRunConfig(const TMRunConfig &config);
+    bool run();
+    bool startAsync();
+    void cancel();
+
+signals:
+    //Emitted on the enumerator's thread while startAsync() runs, as shards finish:
+    void progress(quint64 done, quint64 total);
+
+    //Emitted on the enumerator's thread once startAsync() is done or cancelled:
+    void finished();
+
+private slots:
+    void workerProgress();
+    void workerFinished();
+
+private:
+    //Every string of one length whose number lies in [first, first + count):
+    struct Shard
+    {
+        int length;
+        quint64 first;
+        quint64 count;
+    };
+
+    //The map functor for QtConcurrent::map():
+    struct ShardRunner
+    {
+        TMLanguageEnumerator *enumerator;
+        void operator()(const Shard &shard) const { enumerator->runShard(shard); }
+    };
+
+    bool prepare();
+    void runShard(const Shard &shard);
+    QStringList getStrings(const std::vector<std::vector<quint64>> &bits, int length, int maxStrings) const;
+
+    TuringMachine *m_TM;
+    TMRunConfig m_Config;
+    QStringList m_AlphabetOverride;
+    QStringList m_Alphabet;
+    std::vector<TMSymbol> m_AlphabetIds;
+    QVector<Shard> m_Shards;
+    QVector<LengthCounts> m_Counts;
+    std::vector<std::vector<quint64>> m_Accepted;
+    std::vector<std::vector<quint64>> m_Undecided;
+    QFutureWatcher<void> *m_Watcher;
+    QMutex m_ResultMutex;
+    QElapsedTimer m_Clock;
+    QString m_ErrorString;
+    std::atomic<quint64> m_Done;
+    std::atomic<bool> m_CancelRequested;
+    quint64 m_NumStrings;
+    qint64 m_ElapsedTime;
+    int m_MaxLength;
+    bool m_LeftBounded;
+};
+
+#endif // TMLANGUAGEENUMERATOR_H
@@ -0,0 +1,166 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmmachinedescription.h"
+
+TMMachineDescription::TMMachineDescription():
+    m_NumTransitions(0), m_NumTapes(1)
+{
+}
+
+int TMMachineDescription::getNumStates() const
+{
+    return m_States.size();
+}
+
+int TMMachineDescription::getNumTapes() const
+{
+    return m_NumTapes;
+}
+
+int TMMachineDescription::getNumTransitions() const
+{
+    return m_NumTransitions;
+}
+
+const TMStateDescription &TMMachineDescription::getState(int index) const
+{
+    return m_States[index];
+}
+
+const QVector<TMStateDescription> &TMMachineDescription::getStates() const
+{
+    return m_States;
+}
+
+int TMMachineDescription::indexOf(int stateId) const
+{
+    return m_Index.value(stateId, -1);
+}
+
+bool TMMachineDescription::isEmpty() const
+{
+    return m_States.isEmpty();
+}
+
+void TMMachineDescription::clear()
+{
+    m_States.clear();
+    m_Index.clear();
+    m_NumTransitions = 0;
+    m_NumTapes = 1;
+}
+
+void TMMachineDescription::setNumTapes(int numTapes)
+{
+    m_NumTapes = qMax(1, numTapes);
+}
+
+int TMMachineDescription::addState(int id, bool isStart, bool isHalt)
+{
+    //A state id is only added once:
+    int index = this->indexOf(id);
+    if(index >= 0)
+        return index;
+
+    m_States.append(TMStateDescription{id, isStart, isHalt, QVector<TMTransitionDescription>()});
+    m_Index.insert(id, m_States.size() - 1);
+    return m_States.size() - 1;
+}
+
+bool TMMachineDescription::addTransition(int fromState, int toState, const QString &read, const QString &write, TMMove move)
+{
+    return this->addTransition(fromState, toState, QStringList(read), QStringList(write), QVector<TMMove>(1, move));
+}
+
+bool TMMachineDescription::addTransition(int fromState, int toState, const QStringList &read, const QStringList &write,
+                                         const QVector<TMMove> &move)
+{
+    //Every transition covers all the tapes:
+    int index = this->indexOf(fromState);
+    if(index < 0 || read.length() != m_NumTapes || write.length() != m_NumTapes || move.size() != m_NumTapes)
+        return false;
+
+    m_States[index].transitions.append(TMTransitionDescription{fromState, toState, read, write, move});
+    m_NumTransitions++;
+    return true;
+}
+
+QString TMMachineDescription::stateName(int id)
+{
+    return QString("q%1") .arg(id);
+}
+
+int TMMachineDescription::stateId(const QString &name)
+{
+    //State names are "q" followed by the id, possibly with a "\nSTART" or "\nHALT" tag on the scene:
+    QString number = name.section('\n', 0, 0).trimmed();
+    if(number.startsWith('q') || number.startsWith('Q'))
+        number.remove(0, 1);
+
+    bool ok = false;
+    int id = number.toInt(&ok);
+    return ok ? id : -1;
+}
+
+TMMove TMMachineDescription::move(const QString &move)
+{
+    if(move.compare("L", Qt::CaseInsensitive) == 0)
+        return TMMoveLeft;
+    if(move.compare("R", Qt::CaseInsensitive) == 0)
+        return TMMoveRight;
+    return TMMoveStay;
+}
+
+QString TMMachineDescription::moveName(TMMove move)
+{
+    if(move == TMMoveLeft)
+        return "L";
+    if(move == TMMoveRight)
+        return "R";
+    return "S";
+}
+
+bool TMMachineDescription::parseLabel(const QString &label, int numTapes, TMTransitionDescription &transition)
+{
+    //"read,write,move", each a space separated tuple with one entry per tape:
+    QStringList fields = label.split(',');
+    if(fields.length() != 3)
+        return false;
+
+    transition.read = fields[0].split(' ', Qt::SkipEmptyParts);
+    transition.write = fields[1].split(' ', Qt::SkipEmptyParts);
+    QStringList moves = fields[2].split(' ', Qt::SkipEmptyParts);
+    if(transition.read.length() != numTapes || transition.write.length() != numTapes || moves.length() != numTapes)
+        return false;
+
+    transition.move.clear();
+    for(const QString &m : moves)
+        transition.move.append(move(m));
+    return true;
+}
+
+QString TMMachineDescription::tupleName(const QStringList &symbols)
+{
+    return symbols.join(' ');
+}
+
+QString TMMachineDescription::tupleName(const QVector<TMMove> &moves)
+{
+    QStringList names;
+    for(TMMove m : moves)
+        names.append(moveName(m));
+    return names.join(' ');
+}
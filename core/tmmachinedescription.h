@@ -0,0 +1,94 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMMACHINEDESCRIPTION_H
+#define TMMACHINEDESCRIPTION_H
+
+#include "tmtypes.h"
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/* One labelled edge. States are referred to by their id, the number in their name (q12 has id 12).
+ * read, write and move hold one entry per tape, so a single-tape edge has lists of length one:
+*/
+struct TMTransitionDescription
+{
+    int fromState;
+    int toState;
+    QStringList read;
+    QStringList write;
+    QVector<TMMove> move;
+};
+
+struct TMStateDescription
+{
+    int id;
+    bool isStart;
+    bool isHalt;
+    QVector<TMTransitionDescription> transitions;
+};
+
+/* The states and transitions of a TM as designed, before it is built.
+ *
+ * The design scene, TMXmlLoader and the benchmark corpus fill one in directly, and TuringMachine and the
+ * summary table read it back in a single pass. State ids are plain integers, so a machine can have any
+ * number of states; indexOf() maps an id to the state's position in getStates().
+ *
+ * A machine has one tape unless setNumTapes() says otherwise. On a k-tape machine every transition reads
+ * and writes a k-tuple of symbols and moves each head on its own. As an arrow label such a transition is
+ * written with the tuples separated by spaces, "a -,a a,R S" for two tapes; see parseLabel().
+*/
+class TMMachineDescription
+{
+public:
+    //Constructor:
+    TMMachineDescription();
+
+    //Accessor functions:
+    int getNumStates() const;
+    int getNumTapes() const;
+    int getNumTransitions() const;
+    const TMStateDescription &getState(int index) const;
+    const QVector<TMStateDescription> &getStates() const;
+    int indexOf(int stateId) const;
+    bool isEmpty() const;
+
+    //Mutator functions:
+    void clear();
+    void setNumTapes(int numTapes);
+    int addState(int id, bool isStart, bool isHalt);
+    bool addTransition(int fromState, int toState, const QString &read, const QString &write, TMMove move);
+    bool addTransition(int fromState, int toState, const QStringList &read, const QStringList &write,
+                       const QVector<TMMove> &move);
+
+    //Conversions:
+    static QString stateName(int id);
+    static int stateId(const QString &name);
+    static TMMove move(const QString &move);
+    static QString moveName(TMMove move);
+    static bool parseLabel(const QString &label, int numTapes, TMTransitionDescription &transition);
+    static QString tupleName(const QStringList &symbols);
+    static QString tupleName(const QVector<TMMove> &moves);
+
+private:
+    QVector<TMStateDescription> m_States;
+    QHash<int, int> m_Index;
+    int m_NumTransitions;
+    int m_NumTapes;
+};
+
+#endif // TMMACHINEDESCRIPTION_H
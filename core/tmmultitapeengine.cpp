@@ -0,0 +1,199 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmmultitapeengine.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+TMMultiTapeEngine::TMMultiTapeEngine(const TMMultiTapeMachine *machine):
+    m_Machine(machine), m_Steps(0), m_ElapsedNanoseconds(0), m_State(0), m_Status(TMEngine::Running),
+    m_LeftBounded(true)
+{
+}
+
+TMMultiTapeEngine::Status TMMultiTapeEngine::getStatus() const
+{
+    return m_Status;
+}
+
+int TMMultiTapeEngine::getCurrentState() const
+{
+    return m_State;
+}
+
+int TMMultiTapeEngine::getNumTapes() const
+{
+    return static_cast<int>(m_Tapes.size());
+}
+
+std::uint64_t TMMultiTapeEngine::getSteps() const
+{
+    return m_Steps;
+}
+
+std::int64_t TMMultiTapeEngine::getElapsedTime() const
+{
+    return m_ElapsedNanoseconds / 1000000;
+}
+
+const TMTape &TMMultiTapeEngine::getTape(int tape) const
+{
+    return *m_Tapes[tape];
+}
+
+const TMRunConfig &TMMultiTapeEngine::getRunConfig() const
+{
+    return m_Config;
+}
+
+bool TMMultiTapeEngine::isLeftBounded() const
+{
+    return m_LeftBounded;
+}
+
+void TMMultiTapeEngine::setMachine(const TMMultiTapeMachine *machine)
+{
+    m_Machine = machine;
+}
+
+void TMMultiTapeEngine::setLeftBounded(bool bounded)
+{
+    m_LeftBounded = bounded;
+}
+
+void TMMultiTapeEngine::setRunConfig(const TMRunConfig &config)
+{
+    m_Config = config;
+}
+
+void TMMultiTapeEngine::reset(const std::vector<TMSymbol> &input)
+{
+    //The input goes on the first tape, the others start blank:
+    int numTapes = m_Machine != nullptr ? m_Machine->getNumTapes() : 1;
+    m_Tapes.resize(numTapes);
+    for(int i = 0; i < numTapes; i++)
+    {
+        if(!m_Tapes[i])
+            m_Tapes[i].reset(new TMTape());
+        m_Tapes[i]->load(i == 0 ? input : std::vector<TMSymbol>());
+    }
+    m_Steps = 0;
+    m_ElapsedNanoseconds = 0;
+    m_State = m_Machine != nullptr ? m_Machine->getStartState() : 0;
+    m_Status = TMEngine::Running;
+}
+
+TMMultiTapeEngine::Status TMMultiTapeEngine::run()
+{
+    return this->runUntil(std::numeric_limits<std::uint64_t>::max());
+}
+
+TMMultiTapeEngine::Status TMMultiTapeEngine::runUntil(std::uint64_t step)
+{
+    if(m_Machine == nullptr || m_Machine->isEmpty() || m_Tapes.empty())
+    {
+        m_Status = TMEngine::Crashed;
+        return m_Status;
+    }
+
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point startTime = Clock::now();
+
+    const TMMultiTapeMachine &machine = *m_Machine;
+    const int numTapes = static_cast<int>(m_Tapes.size());
+    const bool leftBounded = m_LeftBounded;
+    TMTape *tapes[TMMultiTapeMachine::MaxTapes];
+    for(int i = 0; i < numTapes; i++)
+        tapes[i] = m_Tapes[i].get();
+    TMSymbol read[TMMultiTapeMachine::MaxTapes] = {};
+    std::uint64_t steps = m_Steps;
+    int state = m_State;
+    Status status = TMEngine::Running;
+
+    //Limits of 0 are unlimited:
+    const std::uint64_t noLimit = std::numeric_limits<std::uint64_t>::max();
+    const std::uint64_t maxSteps = m_Config.getMaxSteps() > 0 ? m_Config.getMaxSteps() : noLimit;
+    const std::int64_t maxTapeCells = m_Config.getMaxTapeCells() > 0 ?
+                                          static_cast<std::int64_t>(m_Config.getMaxTapeCells()) :
+                                          std::numeric_limits<std::int64_t>::max();
+    const std::int64_t maxWallTime = m_Config.getMaxWallTime() * 1000000;
+    const std::uint64_t checkInterval = m_Config.getCheckInterval();
+
+    //As in TMEngine, the hot loop compares the step count against a single bound:
+    std::uint64_t nextCheck = steps + std::min(checkInterval, noLimit - steps);
+    std::uint64_t bound = std::min(std::min(maxSteps, step), nextCheck);
+
+    while(status == TMEngine::Running)
+    {
+        //If the state is a HALT state, accept input:
+        if(machine.isHALTState(state))
+        {
+            status = TMEngine::Accepted;
+            break;
+        }
+
+        if(steps >= bound)
+        {
+            if(steps >= maxSteps)
+            {
+                status = TMEngine::StepLimitReached;
+                break;
+            }
+            if(steps >= step)
+                break;
+
+            std::int64_t elapsed = m_ElapsedNanoseconds +
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+            if(maxWallTime > 0 && elapsed >= maxWallTime)
+            {
+                status = TMEngine::TimeLimitReached;
+                break;
+            }
+            nextCheck = steps + std::min(checkInterval, noLimit - steps);
+            bound = std::min(std::min(maxSteps, step), nextCheck);
+        }
+
+        //Look up the edge for the tuple under the heads:
+        for(int i = 0; i < numTapes; i++)
+            read[i] = tapes[i]->read();
+        const TMMultiTapeTransition *t = machine.getTransition(state, read);
+        if(t == nullptr)
+        {
+            status = TMEngine::Crashed;
+            break;
+        }
+
+        //Write and move on every tape, then change state:
+        for(int i = 0; i < numTapes; i++)
+        {
+            TMTape &tape = *tapes[i];
+            tape.write(t->write[i]);
+            tape.move(t->move[i]);
+            if(leftBounded && tape.getHeadPosition() < 0)
+                status = TMEngine::LeftEndCrash;
+            else if(tape.getRightmost() - tape.getLeftmost() >= maxTapeCells && status == TMEngine::Running)
+                status = TMEngine::TapeLimitReached;
+        }
+        steps++;
+        state = t->nextState;
+    }
+
+    m_Steps = steps;
+    m_State = state;
+    m_Status = status;
+    m_ElapsedNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+    return m_Status;
+}
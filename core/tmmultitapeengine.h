@@ -0,0 +1,73 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMMULTITAPEENGINE_H
+#define TMMULTITAPEENGINE_H
+
+#include "tmengine.h"
+#include "tmmultitapemachine.h"
+#include "tmrunconfig.h"
+#include "tmtape.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* Runs a TMMultiTapeMachine over k tapes of symbol ids.
+ *
+ * The input is written on the first tape and the others start blank; all heads start on cell 0. Every
+ * step reads the k symbols under the heads, finds the transition with one lookup and then writes and
+ * moves on each tape. Tapes are left bounded or not as with TMEngine, and a head moving off the left end
+ * of its tape crashes the machine. Runs stop on the step, wall time and tape cell budgets of the
+ * TMRunConfig; the tape cell budget applies to each tape on its own. Traces, cycle detection and
+ * accelerated mode are single-tape only.
+*/
+class TMMultiTapeEngine
+{
+public:
+    typedef TMEngine::Status Status;
+
+    //Constructor:
+    explicit TMMultiTapeEngine(const TMMultiTapeMachine *machine = nullptr);
+
+    //Accessor functions:
+    Status getStatus() const;
+    int getCurrentState() const;
+    int getNumTapes() const;
+    std::uint64_t getSteps() const;
+    std::int64_t getElapsedTime() const;
+    const TMTape &getTape(int tape) const;
+    const TMRunConfig &getRunConfig() const;
+    bool isLeftBounded() const;
+
+    //Mutator functions:
+    void setMachine(const TMMultiTapeMachine *machine);
+    void setLeftBounded(bool bounded);
+    void setRunConfig(const TMRunConfig &config);
+    void reset(const std::vector<TMSymbol> &input);
+    Status run();
+    Status runUntil(std::uint64_t step);
+
+private:
+    const TMMultiTapeMachine *m_Machine;
+    std::vector<std::unique_ptr<TMTape>> m_Tapes;
+    TMRunConfig m_Config;
+    std::uint64_t m_Steps;
+    std::int64_t m_ElapsedNanoseconds;
+    int m_State;
+    Status m_Status;
+    bool m_LeftBounded;
+};
+
+#endif // TMMULTITAPEENGINE_H
@@ -0,0 +1,193 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmmultitapemachine.h"
+
+TMMultiTapeMachine::TMMultiTapeMachine()
+{
+    this->clear();
+}
+
+int TMMultiTapeMachine::getNumStates() const
+{
+    return m_NumStates;
+}
+
+int TMMultiTapeMachine::getNumTapes() const
+{
+    return m_NumTapes;
+}
+
+int TMMultiTapeMachine::getNumSymbols() const
+{
+    return m_NumSymbols;
+}
+
+int TMMultiTapeMachine::getStartState() const
+{
+    return m_StartState;
+}
+
+const TMSymbolTable &TMMultiTapeMachine::getSymbolTable() const
+{
+    return m_Symbols;
+}
+
+bool TMMultiTapeMachine::isDense() const
+{
+    return m_Dense;
+}
+
+bool TMMultiTapeMachine::isEmpty() const
+{
+    return m_NumStates == 0;
+}
+
+void TMMultiTapeMachine::clear()
+{
+    m_Transitions.clear();
+    m_Slots.clear();
+    m_HALTStates.clear();
+    m_Pending.clear();
+    m_Symbols.clear();
+    m_Radix = 1;
+    m_Stride = 1;
+    m_Mask = 0;
+    m_NumTapes = 1;
+    m_NumStates = 0;
+    m_NumSymbols = m_Symbols.getNumSymbols();
+    m_StartState = 0;
+    m_Dense = true;
+}
+
+void TMMultiTapeMachine::setNumTapes(int numTapes)
+{
+    m_NumTapes = numTapes < 1 ? 1 : (numTapes > MaxTapes ? int(MaxTapes) : numTapes);
+}
+
+void TMMultiTapeMachine::setNumStates(int numStates)
+{
+    m_NumStates = numStates;
+    m_HALTStates.assign(numStates, 0);
+}
+
+void TMMultiTapeMachine::setStartState(int state)
+{
+    if(state >= 0 && state < m_NumStates)
+        m_StartState = state;
+}
+
+void TMMultiTapeMachine::setHALTState(int state, bool isHalt)
+{
+    if(state >= 0 && state < m_NumStates)
+        m_HALTStates[state] = isHalt ? 1 : 0;
+}
+
+TMSymbol TMMultiTapeMachine::addSymbol(const std::string &name)
+{
+    TMSymbol id = m_Symbols.intern(name);
+    m_NumSymbols = m_Symbols.getNumSymbols();
+    return id;
+}
+
+bool TMMultiTapeMachine::addTransition(int from, const std::vector<TMSymbol> &read, int to,
+                                       const std::vector<TMSymbol> &write, const std::vector<int> &move)
+{
+    if(from < 0 || from >= m_NumStates || to < 0 || to >= m_NumStates)
+        return false;
+    if(read.size() != size_t(m_NumTapes) || write.size() != size_t(m_NumTapes) || move.size() != size_t(m_NumTapes))
+        return false;
+
+    PendingTransition p;
+    p.from = from;
+    p.transition.nextState = to;
+    for(int i = 0; i < MaxTapes; i++)
+    {
+        bool used = i < m_NumTapes;
+        p.read[i] = used ? read[i] : 0;
+        p.transition.write[i] = used ? write[i] : 0;
+        p.transition.move[i] = static_cast<std::int8_t>(!used || move[i] == 0 ? TMMoveStay :
+                                                        (move[i] < 0 ? TMMoveLeft : TMMoveRight));
+    }
+    m_Pending.push_back(p);
+    return true;
+}
+
+void TMMultiTapeMachine::compile()
+{
+    //Decide between the dense table and the hash table from the number of (state, tuple) cells:
+    std::uint64_t columns = 1;
+    m_Dense = true;
+    for(int i = 0; i < m_NumTapes && m_Dense; i++)
+    {
+        columns *= static_cast<std::uint64_t>(m_NumSymbols) + 1;
+        if(columns * static_cast<std::uint64_t>(m_NumStates) > MaxDenseEntries)
+            m_Dense = false;
+    }
+    m_Radix = m_Dense ? static_cast<std::uint64_t>(m_NumSymbols) + 1 : (1u << 16);
+
+    TMMultiTapeTransition undefined;
+    undefined.nextState = -1;
+    for(int i = 0; i < MaxTapes; i++)
+    {
+        undefined.write[i] = 0;
+        undefined.move[i] = TMMoveStay;
+    }
+
+    m_Transitions.clear();
+    m_Slots.clear();
+    if(m_Dense)
+    {
+        m_Stride = static_cast<std::size_t>(columns);
+        m_Transitions.assign(static_cast<std::size_t>(m_NumStates) * m_Stride, undefined);
+    }
+    else
+    {
+        //Keep the hash table at most half full:
+        std::size_t size = 16;
+        while(size < m_Pending.size() * 2)
+            size *= 2;
+        m_Mask = size - 1;
+        m_Slots.assign(size, Slot{0, -1, -1});
+        m_Transitions.reserve(m_Pending.size());
+    }
+
+    //The first edge found for a (state, tuple) pair wins, as in the single-tape machine:
+    for(const PendingTransition &p : m_Pending)
+    {
+        std::uint64_t key = 0;
+        for(int i = m_NumTapes - 1; i >= 0; i--)
+            key = key * m_Radix + p.read[i];
+
+        if(m_Dense)
+        {
+            TMMultiTapeTransition &cell = m_Transitions[static_cast<std::size_t>(p.from) * m_Stride + key];
+            if(cell.nextState < 0)
+                cell = p.transition;
+            continue;
+        }
+
+        std::size_t slot = hash(p.from, key) & m_Mask;
+        while(m_Slots[slot].transition >= 0 && !(m_Slots[slot].state == p.from && m_Slots[slot].key == key))
+            slot = (slot + 1) & m_Mask;
+        if(m_Slots[slot].transition >= 0)
+            continue;
+
+        m_Slots[slot] = Slot{key, p.from, static_cast<std::int32_t>(m_Transitions.size())};
+        m_Transitions.push_back(p.transition);
+    }
+    m_Pending.clear();
+    m_Pending.shrink_to_fit();
+}
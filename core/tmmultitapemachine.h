@@ -0,0 +1,137 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMMULTITAPEMACHINE_H
+#define TMMULTITAPEMACHINE_H
+
+#include "tmtypes.h"
+#include "tmsymboltable.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//One transition of a k-tape machine. Only the first k entries of write and move are used:
+struct TMMultiTapeTransition
+{
+    enum {MaxTapes = 4};
+
+    std::int32_t nextState; //-1 if the state has no edge for the tuple
+    TMSymbol write[MaxTapes];
+    std::int8_t move[MaxTapes];
+};
+
+/* The transition function of a k-tape machine, indexed by (state id, tuple of symbol ids read).
+ *
+ * The k symbols under the heads are packed into one key so that finding the transition is a single
+ * lookup, as in TMCompiledMachine. Symbols outside the alphabet are clamped to one "unknown" digit, so
+ * a tuple is a k digit number. When states times the number of such tuples is small the table is dense,
+ * the base is getNumSymbols() + 1 and the key is the column; otherwise the base is 2^16 and the defined
+ * transitions are kept in an open addressing hash table keyed by state and tuple. Up to MaxTapes tapes
+ * are supported.
+*/
+class TMMultiTapeMachine
+{
+public:
+    enum {MaxTapes = TMMultiTapeTransition::MaxTapes, MaxDenseEntries = 1 << 20};
+
+    //Constructor:
+    TMMultiTapeMachine();
+
+    //Accessor functions:
+    int getNumStates() const;
+    int getNumTapes() const;
+    int getNumSymbols() const;
+    int getStartState() const;
+    const TMSymbolTable &getSymbolTable() const;
+    bool isDense() const;
+    bool isEmpty() const;
+
+    //Hot loop accessors, kept inline:
+    bool isHALTState(int state) const
+    {
+        return m_HALTStates[state] != 0;
+    }
+
+    //The transition for the symbols under the k heads, or nullptr if there is none:
+    const TMMultiTapeTransition *getTransition(int state, const TMSymbol *read) const
+    {
+        std::uint64_t key = 0;
+        for(int i = m_NumTapes - 1; i >= 0; i--)
+            key = key * m_Radix + (read[i] < m_NumSymbols ? read[i] : m_NumSymbols);
+
+        if(m_Dense)
+        {
+            const TMMultiTapeTransition &t = m_Transitions[static_cast<std::size_t>(state) * m_Stride + key];
+            return t.nextState >= 0 ? &t : nullptr;
+        }
+
+        for(std::size_t slot = hash(state, key) & m_Mask; ; slot = (slot + 1) & m_Mask)
+        {
+            const Slot &s = m_Slots[slot];
+            if(s.transition < 0)
+                return nullptr;
+            if(s.state == state && s.key == key)
+                return &m_Transitions[s.transition];
+        }
+    }
+
+    //Mutator functions:
+    void clear();
+    void setNumTapes(int numTapes);
+    void setNumStates(int numStates);
+    void setStartState(int state);
+    void setHALTState(int state, bool isHalt);
+    TMSymbol addSymbol(const std::string &name);
+    bool addTransition(int from, const std::vector<TMSymbol> &read, int to, const std::vector<TMSymbol> &write,
+                       const std::vector<int> &move);
+    void compile();
+
+private:
+    struct PendingTransition
+    {
+        int from;
+        TMSymbol read[MaxTapes];
+        TMMultiTapeTransition transition;
+    };
+
+    struct Slot
+    {
+        std::uint64_t key;
+        std::int32_t state;
+        std::int32_t transition; //-1 for an empty slot
+    };
+
+    static std::size_t hash(int state, std::uint64_t key)
+    {
+        std::uint64_t h = key * 0x9E3779B97F4A7C15ull ^ (static_cast<std::uint64_t>(state) + 0x632BE59BD9B4E019ull);
+        return static_cast<std::size_t>(h ^ (h >> 29));
+    }
+
+    std::vector<TMMultiTapeTransition> m_Transitions;
+    std::vector<Slot> m_Slots;
+    std::vector<unsigned char> m_HALTStates;
+    std::vector<PendingTransition> m_Pending;
+    TMSymbolTable m_Symbols;
+    std::uint64_t m_Radix;
+    std::size_t m_Stride;
+    std::size_t m_Mask;
+    int m_NumTapes;
+    int m_NumStates;
+    int m_NumSymbols;
+    int m_StartState;
+    bool m_Dense;
+};
+
+#endif // TMMULTITAPEMACHINE_H
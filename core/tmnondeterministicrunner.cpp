@@ -0,0 +1,381 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmnondeterministicrunner.h"
+#include <QtConcurrent>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <limits>
+
+//Frontier slices handed to the thread pool; smaller frontiers are expanded on the calling thread:
+static const std::size_t SliceSize = 256;
+
+/* The set of configurations seen so far, split into shards so that workers rarely wait on each other.
+ * Each shard is an open addressing table of hashes kept at most half full, next to the configurations
+ * themselves; 0 marks an empty slot, so a hash of 0 is stored as 1. A hash match is confirmed by comparing
+ * the state and tape, which share their chunks with the branches, so a collision never merges two
+ * different configurations.
+*/
+class TMNondeterministicRunner::VisitedSet
+{
+public:
+    enum {NumShards = 64};
+
+    VisitedSet(): m_Size(0)
+    {
+    }
+
+    std::uint64_t size() const
+    {
+        return m_Size;
+    }
+
+    //Returns true if the configuration was not in the set yet:
+    bool insert(std::uint64_t hash, int state, const TMSharedTape &tape)
+    {
+        if(hash == 0)
+            hash = 1;
+
+        Shard &shard = m_Shards[(hash >> 58) % NumShards];
+        QMutexLocker locker(&shard.mutex);
+        if(shard.entries.size() * 2 >= shard.slots.size())
+            grow(shard);
+
+        std::size_t mask = shard.slots.size() - 1;
+        for(std::size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+        {
+            Slot &s = shard.slots[slot];
+            if(s.hash == 0)
+            {
+                s.hash = hash;
+                s.entry = static_cast<std::uint32_t>(shard.entries.size());
+                shard.entries.push_back(Entry{state, tape});
+                m_Size++;
+                return true;
+            }
+            if(s.hash == hash)
+            {
+                const Entry &entry = shard.entries[s.entry];
+                if(entry.state == state && entry.tape.equals(tape))
+                    return false;
+            }
+        }
+    }
+
+private:
+    struct Slot
+    {
+        std::uint64_t hash;
+        std::uint32_t entry;
+    };
+
+    struct Entry
+    {
+        int state;
+        TMSharedTape tape;
+    };
+
+    struct Shard
+    {
+        QMutex mutex;
+        std::vector<Slot> slots;
+        std::vector<Entry> entries;
+    };
+
+    static void grow(Shard &shard)
+    {
+        std::vector<Slot> old(std::max<std::size_t>(shard.slots.size() * 2, 1024), Slot{0, 0});
+        old.swap(shard.slots);
+        std::size_t mask = shard.slots.size() - 1;
+        for(const Slot &s : old)
+        {
+            if(s.hash == 0)
+                continue;
+            std::size_t slot = s.hash & mask;
+            while(shard.slots[slot].hash != 0)
+                slot = (slot + 1) & mask;
+            shard.slots[slot] = s;
+        }
+    }
+
+    Shard m_Shards[NumShards];
+    std::atomic<std::uint64_t> m_Size;
+};
+
+//One slice of the frontier and the configurations it leads to:
+struct TMNondeterministicRunner::Expansion
+{
+    const Branch *begin;
+    const Branch *end;
+    std::vector<Branch> next;
+    bool droppedForTape;
+    bool configurationLimitReached;
+};
+
+static std::uint64_t configurationHash(int state, std::int64_t head, std::uint64_t tapeHash)
+{
+    return TMCycleDetector::cellHash(head, static_cast<TMSymbol>(state + 1)) ^ (tapeHash * 0xD6E8FEB86659FD93ULL);
+}
+
+TMNondeterministicRunner::TMNondeterministicRunner(const TMCompiledMachine *machine):
+    m_Machine(machine), m_Cancel(nullptr), m_Stop(false), m_Depth(0), m_NumConfigurations(0), m_MaxFrontier(0),
+    m_ElapsedNanoseconds(0), m_Status(Running), m_LeftBounded(true)
+{
+}
+
+TMNondeterministicRunner::Status TMNondeterministicRunner::getStatus() const
+{
+    return m_Status;
+}
+
+std::uint64_t TMNondeterministicRunner::getDepth() const
+{
+    return m_Depth;
+}
+
+std::uint64_t TMNondeterministicRunner::getNumConfigurations() const
+{
+    return m_NumConfigurations;
+}
+
+std::uint64_t TMNondeterministicRunner::getMaxFrontier() const
+{
+    return m_MaxFrontier;
+}
+
+std::int64_t TMNondeterministicRunner::getElapsedTime() const
+{
+    return m_ElapsedNanoseconds / 1000000;
+}
+
+const std::vector<TMTraceStep> &TMNondeterministicRunner::getAcceptingPath() const
+{
+    return m_AcceptingPath;
+}
+
+const TMRunConfig &TMNondeterministicRunner::getRunConfig() const
+{
+    return m_Config;
+}
+
+bool TMNondeterministicRunner::isLeftBounded() const
+{
+    return m_LeftBounded;
+}
+
+void TMNondeterministicRunner::setMachine(const TMCompiledMachine *machine)
+{
+    m_Machine = machine;
+}
+
+void TMNondeterministicRunner::setLeftBounded(bool bounded)
+{
+    m_LeftBounded = bounded;
+}
+
+void TMNondeterministicRunner::setRunConfig(const TMRunConfig &config)
+{
+    m_Config = config;
+}
+
+TMNondeterministicRunner::Status TMNondeterministicRunner::run(const std::vector<TMSymbol> &input,
+                                                               const std::atomic<bool> *cancel)
+{
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point startTime = Clock::now();
+
+    m_AcceptingPath.clear();
+    m_Depth = 0;
+    m_NumConfigurations = 0;
+    m_MaxFrontier = 0;
+    m_ElapsedNanoseconds = 0;
+    m_Cancel = cancel;
+    m_Stop = false;
+    if(m_Machine == nullptr || m_Machine->isEmpty())
+    {
+        m_Status = Rejected;
+        return m_Status;
+    }
+
+    //Limits of 0 are unlimited:
+    const std::uint64_t maxSteps = m_Config.getMaxSteps() > 0 ? m_Config.getMaxSteps() :
+                                                                std::numeric_limits<std::uint64_t>::max();
+    const std::int64_t maxWallTime = m_Config.getMaxWallTime() * 1000000;
+
+    std::vector<Branch> frontier(1);
+    frontier[0].tape.load(input);
+    frontier[0].state = m_Machine->getStartState();
+
+    VisitedSet visited;
+    visited.insert(configurationHash(frontier[0].state, 0, frontier[0].tape.getHash()), frontier[0].state, frontier[0].tape);
+    bool droppedForTape = false;
+    Status status = Running;
+    if(m_Machine->isHALTState(frontier[0].state))
+        status = Accepted;
+
+    while(status == Running)
+    {
+        if(frontier.empty())
+        {
+            status = droppedForTape ? TapeLimitReached : Rejected;
+            break;
+        }
+        if(m_Depth >= maxSteps)
+        {
+            status = StepLimitReached;
+            break;
+        }
+        if(cancel != nullptr && *cancel)
+        {
+            status = Cancelled;
+            break;
+        }
+        if(maxWallTime > 0 && std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count() >= maxWallTime)
+        {
+            status = TimeLimitReached;
+            break;
+        }
+        m_MaxFrontier = std::max<std::uint64_t>(m_MaxFrontier, frontier.size());
+
+        //Expand the level, in parallel once it is large enough to be worth it:
+        std::vector<Expansion> expansions;
+        for(std::size_t i = 0; i < frontier.size(); i += SliceSize)
+        {
+            const Branch *begin = frontier.data() + i;
+            expansions.push_back(Expansion{begin, begin + std::min(SliceSize, frontier.size() - i),
+                                           std::vector<Branch>(), false, false});
+        }
+        if(expansions.size() == 1)
+            this->expand(expansions[0], visited);
+        else
+            QtConcurrent::blockingMap(expansions, [this, &visited](Expansion &e) { this->expand(e, visited); });
+        m_Depth++;
+
+        if(!m_AcceptingPath.empty())
+        {
+            status = Accepted;
+            break;
+        }
+
+        //Gather the next level:
+        std::vector<Branch> next;
+        std::size_t size = 0;
+        for(const Expansion &e : expansions)
+            size += e.next.size();
+        next.reserve(size);
+        for(Expansion &e : expansions)
+        {
+            droppedForTape = droppedForTape || e.droppedForTape;
+            if(e.configurationLimitReached)
+                status = ConfigurationLimitReached;
+            std::move(e.next.begin(), e.next.end(), std::back_inserter(next));
+        }
+        if(status == Running && cancel != nullptr && *cancel)
+            status = Cancelled;
+        frontier.swap(next);
+    }
+
+    m_NumConfigurations = visited.size();
+    m_Status = status;
+    m_Cancel = nullptr;
+    m_ElapsedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+    return m_Status;
+}
+
+void TMNondeterministicRunner::expand(Expansion &expansion, VisitedSet &visited)
+{
+    const TMCompiledMachine &machine = *m_Machine;
+    const std::int64_t maxTapeCells = m_Config.getMaxTapeCells() > 0 ?
+                                          static_cast<std::int64_t>(m_Config.getMaxTapeCells()) :
+                                          std::numeric_limits<std::int64_t>::max();
+    const std::uint64_t maxConfigurations = m_Config.getMaxConfigurations() > 0 ? m_Config.getMaxConfigurations() :
+                                                                                  std::numeric_limits<std::uint64_t>::max();
+
+    for(const Branch *branch = expansion.begin; branch != expansion.end; branch++)
+    {
+        //Another worker accepted, ran out of configurations or the run was cancelled:
+        if(m_Stop || (m_Cancel != nullptr && *m_Cancel))
+            return;
+
+        TMSymbol symbol = branch->tape.read();
+        int count = 0;
+        const TMCompiledTransition *choices = machine.getChoices(branch->state, symbol, count);
+        for(int i = 0; i < count; i++)
+        {
+            const TMCompiledTransition &t = choices[i];
+
+            //The child shares the parent's chunks until it writes:
+            Branch child;
+            child.tape = branch->tape;
+            child.state = t.nextState;
+            std::int64_t head = child.tape.getHeadPosition();
+            child.tape.write(t.write);
+            child.tape.move(t.move);
+
+            if(m_LeftBounded && child.tape.getHeadPosition() < 0)
+                continue;
+            if(child.tape.getRightmost() - child.tape.getLeftmost() >= maxTapeCells)
+            {
+                expansion.droppedForTape = true;
+                continue;
+            }
+
+            TMTraceStep step{head, branch->state, t.nextState, symbol, t.write, t.move};
+            child.path = std::make_shared<const PathNode>(PathNode{branch->path, step});
+            if(machine.isHALTState(t.nextState))
+            {
+                this->accept(child);
+                return;
+            }
+
+            if(!visited.insert(configurationHash(child.state, child.tape.getHeadPosition(), child.tape.getHash()),
+                               child.state, child.tape))
+                continue;
+            if(visited.size() >= maxConfigurations)
+            {
+                expansion.configurationLimitReached = true;
+                m_Stop = true;
+                return;
+            }
+            expansion.next.push_back(std::move(child));
+        }
+    }
+}
+
+TMNondeterministicRunner::PathNode::~PathNode()
+{
+    //Freeing the parent here would recurse once per step. A parent nobody else holds is freed by the loop
+    //instead, after its own parent has been taken from it:
+    std::shared_ptr<const PathNode> node = std::move(parent);
+    while(node != nullptr && node.use_count() == 1)
+    {
+        std::shared_ptr<const PathNode> next = std::move(node->parent);
+        node = std::move(next);
+    }
+}
+
+void TMNondeterministicRunner::accept(const Branch &branch)
+{
+    //Only the first branch to halt is kept:
+    QMutexLocker locker(&m_AcceptMutex);
+    m_Stop = true;
+    if(!m_AcceptingPath.empty())
+        return;
+
+    for(const PathNode *node = branch.path.get(); node != nullptr; node = node->parent.get())
+        m_AcceptingPath.push_back(node->step);
+    std::reverse(m_AcceptingPath.begin(), m_AcceptingPath.end());
+}
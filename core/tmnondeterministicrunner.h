@@ -0,0 +1,108 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMNONDETERMINISTICRUNNER_H
+#define TMNONDETERMINISTICRUNNER_H
+
+#include "tmcompiledmachine.h"
+#include "tmrunconfig.h"
+#include "tmsharedtape.h"
+#include "tmtrace.h"
+#include "tmtypes.h"
+#include <QMutex>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* Explores every branch of a nondeterministic TMCompiledMachine breadth first.
+ *
+ * The frontier holds the configurations reached after the same number of steps. Each level is
+ * expanded on the global thread pool: every configuration is followed along each of its choices
+ * (TMCompiledMachine::getChoices()), and tapes share their unchanged chunks through TMSharedTape.
+ * Configurations already seen are dropped using a set keyed by a 64-bit hash of state, head and tape;
+ * a hash match is confirmed by comparing the tapes, so two different configurations are never merged.
+ *
+ * The run accepts as soon as a branch enters a HALT state; getAcceptingPath() gives the steps of
+ * that branch, which is one of the shortest. A branch with no edge for its symbol, or that moves
+ * off the left end of a left bounded tape, dies. The input is rejected once every branch has died.
+ * getMaxSteps() of the TMRunConfig bounds the depth, getMaxConfigurations() the number of distinct
+ * configurations explored and getMaxTapeCells() the tape of each branch; branches over the tape
+ * budget are dropped and turn a later rejection into TapeLimitReached.
+*/
+class TMNondeterministicRunner
+{
+public:
+    enum Status {Running, Accepted, Rejected, StepLimitReached, TapeLimitReached, TimeLimitReached,
+                 ConfigurationLimitReached, Cancelled};
+
+    //Constructor:
+    explicit TMNondeterministicRunner(const TMCompiledMachine *machine = nullptr);
+
+    //Accessor functions:
+    Status getStatus() const;
+    std::uint64_t getDepth() const;
+    std::uint64_t getNumConfigurations() const;
+    std::uint64_t getMaxFrontier() const;
+    std::int64_t getElapsedTime() const;
+    const std::vector<TMTraceStep> &getAcceptingPath() const;
+    const TMRunConfig &getRunConfig() const;
+    bool isLeftBounded() const;
+
+    //Mutator functions:
+    void setMachine(const TMCompiledMachine *machine);
+    void setLeftBounded(bool bounded);
+    void setRunConfig(const TMRunConfig &config);
+    Status run(const std::vector<TMSymbol> &input, const std::atomic<bool> *cancel = nullptr);
+
+private:
+    //The steps leading to a configuration, shared between the branches that split from it. The destructor
+    //unlinks the nodes only it owns in a loop, since a branch can be millions of steps deep:
+    struct PathNode
+    {
+        ~PathNode();
+
+        mutable std::shared_ptr<const PathNode> parent;
+        TMTraceStep step;
+    };
+
+    struct Branch
+    {
+        TMSharedTape tape;
+        int state;
+        std::shared_ptr<const PathNode> path;
+    };
+
+    class VisitedSet;
+    struct Expansion;
+
+    void expand(Expansion &expansion, VisitedSet &visited);
+    void accept(const Branch &branch);
+
+    const TMCompiledMachine *m_Machine;
+    const std::atomic<bool> *m_Cancel;
+    TMRunConfig m_Config;
+    std::vector<TMTraceStep> m_AcceptingPath;
+    std::atomic<bool> m_Stop;
+    QMutex m_AcceptMutex;
+    std::uint64_t m_Depth;
+    std::uint64_t m_NumConfigurations;
+    std::uint64_t m_MaxFrontier;
+    std::int64_t m_ElapsedNanoseconds;
+    Status m_Status;
+    bool m_LeftBounded;
+};
+
+#endif // TMNONDETERMINISTICRUNNER_H
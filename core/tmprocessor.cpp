@@ -0,0 +1,706 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmprocessor.h"
+#include "tmstate.h"
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QtConcurrent>
+
+TMProcessor::TMProcessor(QObject *parent):
+    QObject(parent), m_TM(nullptr), m_CancelRequested(false), m_PauseRequested(false),
+    m_Mode(Compiled), m_Steps(0), m_CurrentState(0), m_Recording(true), m_Profiling(false)
+{
+    m_CrashString = "";
+    m_Watcher = new QFutureWatcher<ProcessResult>(this);
+    connect(m_Watcher, SIGNAL(finished()), this, SLOT(workerFinished()));
+}
+
+TMProcessor::~TMProcessor()
+{
+    //Stop a running worker before the engine goes away:
+    this->cancel();
+    m_Watcher->waitForFinished();
+}
+
+TMProcessor::ProcessResult TMProcessor::start()
+{
+    if(m_TM != nullptr && m_TM->getNumTapes() > 1)
+    {
+        this->prepareCompiled();
+        return this->startMultiTape();
+    }
+    if(m_Mode == Nondeterministic)
+        return this->startNondeterministic();
+    if(m_Mode != Interpreted)
+    {
+        this->prepareCompiled();
+        return this->startCompiled(false);
+    }
+    return this->startInterpreted(false);
+}
+
+void TMProcessor::startAsync()
+{
+    if(this->isRunning())
+        return;
+
+    m_CancelRequested = false;
+    m_PauseRequested = false;
+
+    //Set up on this thread, then hand the run loop to the thread pool:
+    if(m_TM != nullptr && m_TM->getNumTapes() > 1)
+    {
+        this->prepareCompiled();
+        m_Watcher->setFuture(QtConcurrent::run([this]() { return this->startMultiTape(); }));
+    }
+    else if(m_Mode == Nondeterministic)
+        m_Watcher->setFuture(QtConcurrent::run([this]() { return this->startNondeterministic(); }));
+    else if(m_Mode != Interpreted)
+    {
+        this->prepareCompiled();
+        m_Watcher->setFuture(QtConcurrent::run([this]() { return this->startCompiled(true); }));
+    }
+    else
+        m_Watcher->setFuture(QtConcurrent::run([this]() { return this->startInterpreted(true); }));
+}
+
+void TMProcessor::cancel()
+{
+    m_CancelRequested = true;
+    this->setPaused(false);
+}
+
+void TMProcessor::setPaused(bool paused)
+{
+    QMutexLocker locker(&m_PauseMutex);
+    m_PauseRequested = paused;
+    if(!paused)
+        m_PauseCondition.wakeAll();
+}
+
+void TMProcessor::workerFinished()
+{
+    emit this->finished(m_Watcher->result());
+}
+
+TMProcessor::ProcessResult TMProcessor::startInterpreted(bool reportProgress)
+{
+    if(m_TM != NULL && m_TM->getNumStates() > 0)
+    {
+        /* Algorithm:
+         *
+         * Step 1: Check if current state is a HALT state
+         *         If state is HALT state, send accepted signal
+         * Step 2: Read an input letter
+         * Step 3: Check if edge exists
+         * Step 4: If the edge exists, read the write variable and send signal
+         *         If not exist, crash.
+         * Step 5: Read the move variable of the edge and send signal
+         * Step 6: Read the state to which the edge points and update current state variable
+         * Step 7: Repeat till all input has been processed
+        */
+
+        //Clear variables. The interpreted engine is kept as a reference and does not record a trace:
+        m_Trace.clear();
+        m_CrashString = "";
+
+        //Look for start state and set it to current state:
+        for(int i = 0; i < m_TM->getNumStates(); i++)
+        {
+            if(m_TM->getState(i).isSTARTState())
+            {
+                m_CurrentState = i;
+                break;
+            }
+        }
+
+        //The tape holds one symbol name per cell:
+        m_InputSymbols = m_TM->tokenize(m_InputString);
+        if(m_InputSymbols.isEmpty())
+            m_InputSymbols.append("-");
+        m_CurrentInput = 0;
+        m_Crashed = false;
+        m_Accepted = false;
+        bool edgeFound = false;
+        bool beyondTapeLimits = false;
+        quint64 loopCount = 0;
+        ProcessResult result = Successful;
+
+        //Limits of 0 are unlimited:
+        const quint64 maxSteps = m_Config.getMaxSteps();
+        const quint64 maxTapeCells = m_Config.getMaxTapeCells();
+        const quint64 sliceSize = 1 << 16;
+        QElapsedTimer clock;
+        clock.start();
+        qint64 lastReportTime = 0;
+        quint64 lastReportSteps = 0;
+
+        //Test every letter in the input string:
+        while(!m_Crashed && !m_Accepted)
+        {
+            TMState tempState = m_TM->getState(m_CurrentState);
+
+            //If the state is a HALT state, accept input:
+            if(tempState.isHALTState())
+            {
+                this->accept();
+                break;
+            }
+
+            //Check the budgets:
+            if(maxSteps > 0 && loopCount >= maxSteps)
+            {
+                result = StepLimitReached;
+                break;
+            }
+            if(maxTapeCells > 0 && quint64(m_InputSymbols.length()) > maxTapeCells)
+            {
+                result = TapeLimitReached;
+                break;
+            }
+            if(loopCount % m_Config.getCheckInterval() == 0 && m_Config.getMaxWallTime() > 0 &&
+                    clock.elapsed() >= m_Config.getMaxWallTime())
+            {
+                result = TimeLimitReached;
+                break;
+            }
+
+            //Pause and report progress between slices, as startCompiled() does:
+            if(loopCount % sliceSize == 0 && loopCount > 0)
+            {
+                if(m_PauseRequested)
+                {
+                    QMutexLocker locker(&m_PauseMutex);
+                    while(m_PauseRequested && !m_CancelRequested)
+                        m_PauseCondition.wait(&m_PauseMutex);
+                }
+
+                if(reportProgress && clock.elapsed() - lastReportTime >= 100)
+                {
+                    qint64 elapsed = clock.elapsed();
+                    double rate = (loopCount - lastReportSteps) * 1000.0 / qMax<qint64>(1, elapsed - lastReportTime);
+                    emit this->progress(loopCount, rate, 0, m_InputSymbols.length() - 1);
+                    lastReportTime = elapsed;
+                    lastReportSteps = loopCount;
+                }
+            }
+            if(m_CancelRequested)
+            {
+                result = Cancelled;
+                break;
+            }
+
+            //If the current state is not a HALT state, process:
+            //Check if the current state has an edge with the same character on its read as the letter on the tape:
+            edgeFound = false;
+            for(int j = 0; j < tempState.getNumEdges(); j++)
+            {
+                if(m_CurrentInput > -1 && (tempState.getEdge(j).getRead() == m_InputSymbols[m_CurrentInput]))
+                {
+                    edgeFound = true;
+                    this->write(tempState.getEdge(j).getWrite());
+                    this->move(tempState.getEdge(j).getMove());
+                    m_CurrentState = m_TM->getStateIndex(tempState.getEdge(j).getToState());
+                    if(m_CurrentInput < 0)
+                        beyondTapeLimits = true;
+                    break;
+                }
+            }
+
+            //If the tape head tried to move too far to the left:
+            if(beyondTapeLimits)
+            {
+                m_CrashString.append(QString("The tape head tried to move passed the left end of the tape"));
+                this->crash();
+                break;
+            }
+
+            //If the edge was not found:
+            if(!edgeFound)
+            {
+                if(!edgeFound)
+                    m_CrashString.append(QString("State q%1 has no edge with read parameter = \'%2\'")
+                                             .arg(tempState.getStateNum()).arg(m_InputSymbols.value(m_CurrentInput)));
+                this->crash();
+                break;
+            }
+            loopCount++;
+        }
+        m_Steps = loopCount;
+
+        if(reportProgress)
+            emit this->progress(m_Steps, m_Steps * 1000.0 / qMax<qint64>(1, clock.elapsed()), 0, m_InputSymbols.length() - 1);
+        return result;
+    }
+    return Successful;
+}
+
+void TMProcessor::prepareCompiled()
+{
+    //Clear variables:
+    m_Trace.clear();
+    m_Profile.clear();
+    m_ExtraSymbols.clear();
+    m_CrashString = "";
+    m_Steps = 0;
+
+    if(m_TM == nullptr || m_TM->getNumStates() == 0)
+        return;
+
+    std::vector<TMSymbol> tape = this->encodeInput(m_TM->getSymbolTable());
+    if(m_TM->getNumTapes() > 1)
+    {
+        m_MultiTapeEngine.setMachine(&m_TM->getMultiTapeMachine());
+        m_MultiTapeEngine.setRunConfig(m_Config);
+        m_MultiTapeEngine.setLeftBounded(m_Engine.isLeftBounded());
+        m_MultiTapeEngine.reset(tape);
+        return;
+    }
+
+    const TMCompiledMachine &machine = m_TM->getCompiledMachine();
+    m_Engine.setMachine(&machine);
+    m_Engine.setRunConfig(m_Config);
+    m_Engine.setAccelerated(m_Mode == Accelerated);
+    m_Engine.setProfile(m_Profiling && m_Mode == Compiled ? &m_Profile : nullptr);
+    m_Engine.reset(tape);
+}
+
+std::vector<TMSymbol> TMProcessor::encodeInput(const TMSymbolTable &symbols)
+{
+    //Cells past the input read as blank on the engine's tape:
+    std::vector<std::string> input = symbols.tokenize(m_InputString.toStdString());
+    if(!input.empty() && input.back() == "-")
+        input.pop_back();
+
+    //Encode the input as symbol ids. Symbols no edge reads get ids past the end of the alphabet:
+    std::vector<TMSymbol> tape;
+    tape.reserve(input.size());
+    for(const std::string &symbol : input)
+    {
+        int id = symbols.find(symbol);
+        if(id < 0)
+        {
+            QString letter = QString::fromStdString(symbol);
+            int extra = m_ExtraSymbols.indexOf(letter);
+            if(extra < 0)
+            {
+                m_ExtraSymbols.append(letter);
+                extra = m_ExtraSymbols.length() - 1;
+            }
+            id = symbols.getNumSymbols() + extra;
+        }
+        tape.push_back(static_cast<TMSymbol>(id));
+    }
+    return tape;
+}
+
+TMProcessor::ProcessResult TMProcessor::startCompiled(bool reportProgress)
+{
+    if(m_TM == nullptr || m_TM->getNumStates() == 0)
+        return Successful;
+
+    const quint64 sliceSize = 1 << 16;
+    TMTrace *trace = m_Recording && m_Mode != Accelerated ? &m_Trace : nullptr;
+    TMEngine::Status status = TMEngine::Running;
+    bool cancelled = false;
+
+    QElapsedTimer clock;
+    clock.start();
+    qint64 lastReportTime = 0;
+    quint64 lastReportSteps = 0;
+
+    //Run the machine in slices so that pausing, cancelling and progress reports stay out of the hot loop:
+    while(true)
+    {
+        status = m_Engine.runUntil(m_Engine.getSteps() + sliceSize, trace);
+        if(status != TMEngine::Running)
+            break;
+
+        if(m_PauseRequested)
+        {
+            QMutexLocker locker(&m_PauseMutex);
+            while(m_PauseRequested && !m_CancelRequested)
+                m_PauseCondition.wait(&m_PauseMutex);
+        }
+
+        if(m_CancelRequested)
+        {
+            cancelled = true;
+            break;
+        }
+
+        if(reportProgress && clock.elapsed() - lastReportTime >= 100)
+        {
+            quint64 steps = m_Engine.getSteps();
+            qint64 elapsed = clock.elapsed();
+            double rate = (steps - lastReportSteps) * 1000.0 / qMax<qint64>(1, elapsed - lastReportTime);
+            emit this->progress(steps, rate, m_Engine.getLeftmost(), m_Engine.getRightmost());
+            lastReportTime = elapsed;
+            lastReportSteps = steps;
+        }
+    }
+
+    m_Steps = m_Engine.getSteps();
+    m_CurrentState = m_Engine.getCurrentState();
+    m_CurrentInput = static_cast<int>(m_Engine.getHeadPosition());
+    m_Accepted = status == TMEngine::Accepted;
+    m_Crashed = status == TMEngine::Crashed || status == TMEngine::LeftEndCrash;
+
+    if(reportProgress)
+        emit this->progress(m_Steps, m_Steps * 1000.0 / qMax<qint64>(1, clock.elapsed()),
+                            m_Engine.getLeftmost(), m_Engine.getRightmost());
+
+    if(status == TMEngine::Crashed)
+        m_CrashString = QString("State %1 has no edge with read parameter = \'%2\'")
+                            .arg(this->getStateName(m_CurrentState)).arg(this->getSymbolName(m_Engine.read()));
+    else if(status == TMEngine::LeftEndCrash)
+        m_CrashString = QString("The tape head tried to move passed the left end of the tape");
+
+    if(cancelled)
+        return Cancelled;
+    return this->toProcessResult(status);
+}
+
+TMProcessor::ProcessResult TMProcessor::startMultiTape()
+{
+    if(m_TM == nullptr || m_TM->getNumStates() == 0)
+        return Successful;
+
+    const quint64 sliceSize = 1 << 16;
+    TMEngine::Status status = TMEngine::Running;
+    bool cancelled = false;
+
+    //Run in slices so that pausing and cancelling stay out of the hot loop, as startCompiled() does:
+    while(true)
+    {
+        status = m_MultiTapeEngine.runUntil(m_MultiTapeEngine.getSteps() + sliceSize);
+        if(status != TMEngine::Running)
+            break;
+
+        if(m_PauseRequested)
+        {
+            QMutexLocker locker(&m_PauseMutex);
+            while(m_PauseRequested && !m_CancelRequested)
+                m_PauseCondition.wait(&m_PauseMutex);
+        }
+
+        if(m_CancelRequested)
+        {
+            cancelled = true;
+            break;
+        }
+    }
+
+    m_Steps = m_MultiTapeEngine.getSteps();
+    m_CurrentState = m_MultiTapeEngine.getCurrentState();
+    m_CurrentInput = static_cast<int>(m_MultiTapeEngine.getTape(0).getHeadPosition());
+    m_Accepted = status == TMEngine::Accepted;
+    m_Crashed = status == TMEngine::Crashed || status == TMEngine::LeftEndCrash;
+
+    if(status == TMEngine::Crashed)
+    {
+        QStringList read;
+        for(int i = 0; i < m_MultiTapeEngine.getNumTapes(); i++)
+            read.append(this->getSymbolName(m_MultiTapeEngine.getTape(i).read()));
+        m_CrashString = QString("State %1 has no edge with read parameter = \'%2\'")
+                            .arg(this->getStateName(m_CurrentState)).arg(read.join(' '));
+    }
+    else if(status == TMEngine::LeftEndCrash)
+        m_CrashString = QString("A tape head tried to move passed the left end of its tape");
+
+    if(cancelled)
+        return Cancelled;
+    return this->toProcessResult(status);
+}
+
+TMProcessor::ProcessResult TMProcessor::startNondeterministic()
+{
+    //Clear variables:
+    m_Trace.clear();
+    m_Profile.clear();
+    m_ExtraSymbols.clear();
+    m_CrashString = "";
+    m_Steps = 0;
+    m_Accepted = false;
+    m_Crashed = false;
+
+    if(m_TM == nullptr || m_TM->getNumStates() == 0)
+        return Successful;
+
+    const TMCompiledMachine &machine = m_TM->getCompiledMachine();
+    std::vector<TMSymbol> input = this->encodeInput(m_TM->getSymbolTable());
+    m_Runner.setMachine(&machine);
+    m_Runner.setRunConfig(m_Config);
+    m_Runner.setLeftBounded(m_Engine.isLeftBounded());
+    TMNondeterministicRunner::Status status = m_Runner.run(input, &m_CancelRequested);
+
+    //Replay the accepting branch so that the trace reads like a deterministic run:
+    const std::vector<TMTraceStep> &path = m_Runner.getAcceptingPath();
+    m_CurrentState = path.empty() ? machine.getStartState() : path.back().toState;
+    m_CurrentInput = 0;
+    if(m_Recording && status == TMNondeterministicRunner::Accepted)
+    {
+        TMTape tape;
+        tape.load(input);
+        m_Trace.begin(tape, machine.getStartState());
+        for(const TMTraceStep &step : path)
+        {
+            tape.write(step.newSymbol);
+            tape.move(step.move);
+            m_Trace.addStep(step, tape);
+        }
+        m_Trace.finish(m_CurrentState);
+        m_CurrentInput = static_cast<int>(tape.getHeadPosition());
+    }
+
+    m_Steps = m_Runner.getDepth();
+    m_Accepted = status == TMNondeterministicRunner::Accepted;
+    m_Crashed = status == TMNondeterministicRunner::Rejected;
+    if(m_Crashed)
+        m_CrashString = QString("Every branch crashed (%1 configurations explored)")
+                            .arg(m_Runner.getNumConfigurations());
+
+    switch(status)
+    {
+    case TMNondeterministicRunner::StepLimitReached:
+        return StepLimitReached;
+    case TMNondeterministicRunner::TapeLimitReached:
+        return TapeLimitReached;
+    case TMNondeterministicRunner::TimeLimitReached:
+        return TimeLimitReached;
+    case TMNondeterministicRunner::ConfigurationLimitReached:
+        return ConfigurationLimitReached;
+    case TMNondeterministicRunner::Cancelled:
+        return Cancelled;
+    default:
+        return Successful;
+    }
+}
+
+TMProcessor::ProcessResult TMProcessor::toProcessResult(TMEngine::Status status) const
+{
+    switch(status)
+    {
+    case TMEngine::StepLimitReached:
+        return StepLimitReached;
+    case TMEngine::TapeLimitReached:
+        return TapeLimitReached;
+    case TMEngine::TimeLimitReached:
+        return TimeLimitReached;
+    case TMEngine::TraceLimitReached:
+        return TraceLimitReached;
+    case TMEngine::CycleDetected:
+        return CycleDetected;
+    case TMEngine::TranslatedCycleDetected:
+        return TranslatedCycleDetected;
+    default:
+        return Successful;
+    }
+}
+
+QString TMProcessor::getSymbolName(TMSymbol symbol) const
+{
+    if(m_TM == nullptr)
+        return QString();
+
+    const TMSymbolTable &symbols = m_TM->getSymbolTable();
+    if(symbol < symbols.getNumSymbols())
+        return QString::fromStdString(symbols.getName(symbol));
+    return m_ExtraSymbols.value(symbol - symbols.getNumSymbols());
+}
+
+QStringList TMProcessor::getSymbolNames() const
+{
+    //Indexed by symbol id: the machine's symbols, then the ones only found in the input:
+    QStringList names;
+    if(m_TM != nullptr)
+    {
+        const TMSymbolTable &symbols = m_TM->getSymbolTable();
+        for(int i = 0; i < symbols.getNumSymbols(); i++)
+            names.append(QString::fromStdString(symbols.getName(TMSymbol(i))));
+    }
+    return names + m_ExtraSymbols;
+}
+
+void TMProcessor::setParameters(QString input, TuringMachine *theTM)
+{
+    m_InputString = input;
+    m_TM = theTM;
+}
+
+void TMProcessor::setExecutionMode(ExecutionMode mode)
+{
+    m_Mode = mode;
+}
+
+void TMProcessor::setRecordingEnabled(bool enabled)
+{
+    m_Recording = enabled;
+}
+
+void TMProcessor::setProfilingEnabled(bool enabled)
+{
+    m_Profiling = enabled;
+}
+
+void TMProcessor::setLeftBounded(bool bounded)
+{
+    m_Engine.setLeftBounded(bounded);
+}
+
+void TMProcessor::setRunConfig(const TMRunConfig &config)
+{
+    m_Config = config;
+}
+
+const TMTrace &TMProcessor::getTrace() const
+{
+    return m_Trace;
+}
+
+const TMProfile &TMProcessor::getProfile() const
+{
+    return m_Profile;
+}
+
+const TMCycleDetector &TMProcessor::getCycleDetector() const
+{
+    return m_Engine.getCycleDetector();
+}
+
+const TMTranslatedCycleDetector &TMProcessor::getTranslatedCycleDetector() const
+{
+    return m_Engine.getTranslatedCycleDetector();
+}
+
+const TMNondeterministicRunner &TMProcessor::getNondeterministicRunner() const
+{
+    return m_Runner;
+}
+
+QString TMProcessor::getCrashString() const
+{
+    return m_CrashString;
+}
+
+QString TMProcessor::getStateName(int state) const
+{
+    //Compiled state indices follow the description, so the name comes straight from it:
+    if(m_TM == nullptr || state < 0 || state >= m_TM->getDescription().getNumStates())
+        return QString("q%1") .arg(state);
+    return TMMachineDescription::stateName(m_TM->getDescription().getState(state).id);
+}
+
+QString TMProcessor::getLimitString(ProcessResult result) const
+{
+    switch(result)
+    {
+    case StepLimitReached:
+        return QString("The step limit of %1 steps was reached") .arg(m_Config.getMaxSteps());
+    case TapeLimitReached:
+        return QString("The tape limit of %1 cells was reached") .arg(m_Config.getMaxTapeCells());
+    case TimeLimitReached:
+        return QString("The time limit of %1 ms was reached") .arg(m_Config.getMaxWallTime());
+    case TraceLimitReached:
+        return QString("The trace memory limit of %1 bytes was reached") .arg(m_Config.getMaxTraceMemory());
+    case ConfigurationLimitReached:
+        return QString("The limit of %1 configurations was reached before any branch halted")
+                .arg(m_Config.getMaxConfigurations());
+    case CycleDetected:
+        return QString("The TM never halts: from step %1 it repeats the same configuration every %2 steps")
+                .arg(m_Engine.getCycleDetector().getCycleStart()) .arg(m_Engine.getCycleDetector().getCycleLength());
+    case TranslatedCycleDetected:
+        return QString("The TM never halts (translated cycle): from step %1 it repeats every %2 steps, "
+                       "shifted %3 cells to the %4")
+                .arg(m_Engine.getTranslatedCycleDetector().getCycleStart())
+                .arg(m_Engine.getTranslatedCycleDetector().getPeriod())
+                .arg(qAbs(m_Engine.getTranslatedCycleDetector().getOffset()))
+                .arg(m_Engine.getTranslatedCycleDetector().getOffset() > 0 ? "right" : "left");
+    default:
+        return QString();
+    }
+}
+
+TMProcessor::ExecutionMode TMProcessor::getExecutionMode() const
+{
+    return m_Mode;
+}
+
+const TMRunConfig &TMProcessor::getRunConfig() const
+{
+    return m_Config;
+}
+
+quint64 TMProcessor::getSteps() const
+{
+    return m_Steps;
+}
+
+std::size_t TMProcessor::getTapeMemoryUsage() const
+{
+    if(m_TM != nullptr && m_TM->getNumTapes() > 1)
+    {
+        std::size_t bytes = 0;
+        for(int i = 0; i < m_MultiTapeEngine.getNumTapes(); i++)
+            bytes += m_MultiTapeEngine.getTape(i).getMemoryUsage();
+        return bytes;
+    }
+    //The interpreted engine's tape is a list of strings, counted as one short string per cell.
+    //Nondeterministic runs keep no tape once they are done:
+    if(m_Mode == Interpreted)
+        return std::size_t(m_InputSymbols.size()) * (sizeof(QString) + 2 * sizeof(QChar));
+    if(m_Mode == Nondeterministic)
+        return 0;
+    return m_Engine.getTapeMemoryUsage();
+}
+
+bool TMProcessor::isRunning() const
+{
+    return m_Watcher->isRunning();
+}
+
+bool TMProcessor::isPaused() const
+{
+    return m_PauseRequested;
+}
+
+void TMProcessor::write(QString output)
+{
+    if(m_CurrentInput > -1)
+        m_InputSymbols[m_CurrentInput] = output;
+}
+
+void TMProcessor::move(QString move)
+{
+    if(move.toLower() == 'l')
+        m_CurrentInput--;
+    else if(move.toLower() == 'r')
+        m_CurrentInput++;
+
+    //Extend the tape with a blank when moving past its right end:
+    if(m_CurrentInput == m_InputSymbols.length())
+        m_InputSymbols.append("-");
+}
+
+void TMProcessor::crash()
+{
+    m_Crashed = true;
+}
+
+void TMProcessor::accept()
+{
+    m_Accepted = true;
+}
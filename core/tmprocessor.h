@@ -0,0 +1,128 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMPROCESSOR_H
+#define TMPROCESSOR_H
+
+#include "turingmachine.h"
+#include "tmengine.h"
+#include "tmmultitapeengine.h"
+#include "tmnondeterministicrunner.h"
+#include <QObject>
+#include <QString>
+#include <QFutureWatcher>
+#include <QMutex>
+#include <QWaitCondition>
+#include <atomic>
+
+class TMProcessor : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    //Each budget of the TMRunConfig has its own result. The cycle results mean the TM definitely never halts:
+    enum ProcessResult{Successful, StepLimitReached, TapeLimitReached, TimeLimitReached, TraceLimitReached,
+                       CycleDetected, TranslatedCycleDetected, ConfigurationLimitReached, Cancelled};
+    //Accelerated runs the compiled machine on a run-length encoded tape and records no trace.
+    //Nondeterministic explores every choice with TMNondeterministicRunner; the trace holds the accepting branch.
+    //Machines with more than one tape always run on TMMultiTapeEngine and record no trace either.
+    //Only Compiled runs fill the profile when profiling is enabled:
+    enum ExecutionMode{Interpreted, Compiled, Accelerated, Nondeterministic};
+
+    //Constructor and destructor:
+    TMProcessor(QObject *parent);
+    ~TMProcessor();
+
+    //Mutator Member Functions:
+    ProcessResult start();
+    void startAsync();
+    void cancel();
+    void setPaused(bool paused);
+    void setParameters(QString input, TuringMachine *theTM);
+    void setExecutionMode(ExecutionMode mode);
+    void setRecordingEnabled(bool enabled);
+    void setProfilingEnabled(bool enabled);
+    void setLeftBounded(bool bounded);
+    void setRunConfig(const TMRunConfig &config);
+    void write(QString output);
+    void move(QString move);
+    void crash();
+    void accept();
+
+    //Accessor member functions:
+    const TMTrace &getTrace() const;
+    const TMProfile &getProfile() const;
+    const TMCycleDetector &getCycleDetector() const;
+    const TMTranslatedCycleDetector &getTranslatedCycleDetector() const;
+    const TMNondeterministicRunner &getNondeterministicRunner() const;
+    QString getCrashString() const;
+    QString getSymbolName(TMSymbol symbol) const;
+    QStringList getSymbolNames() const;
+    QString getStateName(int state) const;
+    QString getLimitString(ProcessResult result) const;
+    ExecutionMode getExecutionMode() const;
+    const TMRunConfig &getRunConfig() const;
+    quint64 getSteps() const;
+    std::size_t getTapeMemoryUsage() const;
+    bool isRunning() const;
+    bool isPaused() const;
+
+signals:
+    //Emitted from the worker thread at most every 100 ms while startAsync() runs:
+    void progress(quint64 steps, double stepsPerSecond, qint64 leftmost, qint64 rightmost);
+
+    //Emitted on the processor's thread once startAsync() is done, with a ProcessResult:
+    void finished(int result);
+
+private slots:
+    void workerFinished();
+
+private:
+    ProcessResult startInterpreted(bool reportProgress);
+    ProcessResult startCompiled(bool reportProgress);
+    ProcessResult startMultiTape();
+    ProcessResult startNondeterministic();
+    ProcessResult toProcessResult(TMEngine::Status status) const;
+    std::vector<TMSymbol> encodeInput(const TMSymbolTable &symbols);
+    void prepareCompiled();
+
+    QString m_InputString;
+    QStringList m_InputSymbols;
+    QString m_CrashString;
+    QStringList m_ExtraSymbols;
+    TMTrace m_Trace;
+    TMProfile m_Profile;
+    TMRunConfig m_Config;
+    TuringMachine *m_TM;
+    TMEngine m_Engine;
+    TMMultiTapeEngine m_MultiTapeEngine;
+    TMNondeterministicRunner m_Runner;
+    QFutureWatcher<ProcessResult> *m_Watcher;
+    QMutex m_PauseMutex;
+    QWaitCondition m_PauseCondition;
+    std::atomic<bool> m_CancelRequested;
+    std::atomic<bool> m_PauseRequested;
+    ExecutionMode m_Mode;
+    quint64 m_Steps;
+    int m_CurrentState;
+    int m_CurrentInput;
+    bool m_Crashed;
+    bool m_Accepted;
+    bool m_Recording;
+    bool m_Profiling;
+};
+
+#endif // TMPROCESSOR_H
@@ -0,0 +1,182 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmprofile.h"
+#include <algorithm>
+
+TMProfile::TMProfile()
+{
+    this->clear();
+}
+
+int TMProfile::getNumStates() const
+{
+    return static_cast<int>(m_StateHits.size());
+}
+
+int TMProfile::getNumSymbols() const
+{
+    return m_NumSymbols;
+}
+
+std::uint64_t TMProfile::getSteps() const
+{
+    return m_Steps;
+}
+
+std::uint64_t TMProfile::getStateHits(int state) const
+{
+    //The steps taken from the state, plus one if the run ended in it:
+    if(state < 0 || state >= this->getNumStates())
+        return 0;
+    return m_StateHits[static_cast<std::size_t>(state)] + (m_Started && state == m_FinalState ? 1 : 0);
+}
+
+std::uint64_t TMProfile::getTransitionHits(int state, TMSymbol symbol) const
+{
+    if(state < 0 || state >= this->getNumStates())
+        return 0;
+    return m_TransitionHits[static_cast<std::size_t>(state) * m_Stride + (symbol < m_NumSymbols ? symbol : m_NumSymbols)];
+}
+
+std::uint64_t TMProfile::getMoves(int direction) const
+{
+    if(direction < -1 || direction > 1)
+        return 0;
+    return m_Moves[direction + 1];
+}
+
+std::uint64_t TMProfile::getCellVisits(std::int64_t position) const
+{
+    std::uint64_t cell = static_cast<std::uint64_t>(position - m_CellOrigin);
+    return cell < m_CellVisits.size() ? m_CellVisits[cell] : 0;
+}
+
+std::int64_t TMProfile::getLowestCell() const
+{
+    //The counters are grown ahead of the head, so skip the cells that were never visited:
+    std::size_t cell = 0;
+    while(cell + 1 < m_CellVisits.size() && m_CellVisits[cell] == 0)
+        cell++;
+    return m_CellOrigin + static_cast<std::int64_t>(cell);
+}
+
+std::int64_t TMProfile::getHighestCell() const
+{
+    std::size_t cell = m_CellVisits.empty() ? 0 : m_CellVisits.size() - 1;
+    while(cell > 0 && m_CellVisits[cell] == 0)
+        cell--;
+    return m_CellOrigin + static_cast<std::int64_t>(cell);
+}
+
+const std::vector<TMProfile::ExtentSample> &TMProfile::getExtentSamples() const
+{
+    return m_ExtentSamples;
+}
+
+std::uint64_t TMProfile::getSampleInterval() const
+{
+    return m_SampleInterval;
+}
+
+std::int64_t TMProfile::getElapsedTime() const
+{
+    return m_ElapsedNanoseconds / 1000000;
+}
+
+int TMProfile::getFinalState() const
+{
+    return m_FinalState;
+}
+
+bool TMProfile::isEmpty() const
+{
+    return !m_Started;
+}
+
+void TMProfile::clear()
+{
+    m_StateHits.clear();
+    m_TransitionHits.clear();
+    m_CellVisits.clear();
+    m_ExtentSamples.clear();
+    std::fill(m_Moves, m_Moves + 3, 0);
+    m_Steps = 0;
+    m_SampleInterval = 1;
+    m_NextSample = 1;
+    m_CellOrigin = 0;
+    m_ElapsedNanoseconds = 0;
+    m_NumSymbols = 0;
+    m_Stride = 1;
+    m_FinalState = 0;
+    m_Started = false;
+}
+
+void TMProfile::begin(const TMCompiledMachine &machine, const TMTape &tape, int state)
+{
+    //One counter per cell of the transition table, including its undefined column:
+    this->clear();
+    m_NumSymbols = machine.getNumSymbols();
+    m_Stride = m_NumSymbols + 1;
+    m_StateHits.assign(static_cast<std::size_t>(machine.getNumStates()), 0);
+    m_TransitionHits.assign(static_cast<std::size_t>(machine.getNumStates()) * m_Stride, 0);
+    m_CellOrigin = tape.getHeadPosition();
+    m_CellVisits.assign(1, 0);
+    m_ExtentSamples.push_back(ExtentSample{0, tape.getLeftmost(), tape.getRightmost()});
+    m_FinalState = state;
+    m_Started = true;
+}
+
+void TMProfile::finish(const TMTape &tape, int state, std::int64_t elapsedNanoseconds)
+{
+    //Called after every slice of a run, so the last sample is replaced rather than added:
+    m_FinalState = state;
+    m_ElapsedNanoseconds = elapsedNanoseconds;
+    if(!m_ExtentSamples.empty() && m_ExtentSamples.back().step == m_Steps)
+        m_ExtentSamples.back() = ExtentSample{m_Steps, tape.getLeftmost(), tape.getRightmost()};
+    else
+        m_ExtentSamples.push_back(ExtentSample{m_Steps, tape.getLeftmost(), tape.getRightmost()});
+}
+
+void TMProfile::addCellVisit(std::int64_t head)
+{
+    //Grow by at least the current size, so that sweeps over new cells stay amortized:
+    std::int64_t size = static_cast<std::int64_t>(m_CellVisits.size());
+    if(head < m_CellOrigin)
+    {
+        std::int64_t grow = std::max(m_CellOrigin - head, size);
+        m_CellVisits.insert(m_CellVisits.begin(), static_cast<std::size_t>(grow), 0);
+        m_CellOrigin -= grow;
+    }
+    else
+        m_CellVisits.resize(static_cast<std::size_t>(std::max(head - m_CellOrigin + 1, 2 * size)), 0);
+    m_CellVisits[static_cast<std::size_t>(head - m_CellOrigin)]++;
+}
+
+void TMProfile::addExtentSample(const TMTape &tape)
+{
+    m_ExtentSamples.push_back(ExtentSample{m_Steps, tape.getLeftmost(), tape.getRightmost()});
+
+    //Keep every other sample and sample half as often once the buffer is full:
+    if(m_ExtentSamples.size() >= MaxExtentSamples)
+    {
+        std::size_t kept = 0;
+        for(std::size_t i = 0; i < m_ExtentSamples.size(); i += 2)
+            m_ExtentSamples[kept++] = m_ExtentSamples[i];
+        m_ExtentSamples.resize(kept);
+        m_SampleInterval *= 2;
+    }
+    m_NextSample = m_Steps + m_SampleInterval;
+}
@@ -0,0 +1,109 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMPROFILE_H
+#define TMPROFILE_H
+
+#include "tmcompiledmachine.h"
+#include "tmtape.h"
+#include "tmtypes.h"
+#include <cstdint>
+#include <vector>
+
+/* Execution counters for one run of a TMCompiledMachine, filled in by TMEngine's run loop.
+ *
+ * For every step the profile counts the state it was taken from, the transition (state and symbol
+ * read), the direction the head moved and the cell the head was on. Every getSampleInterval() steps it
+ * also samples the extent of the visited tape; when there are MaxExtentSamples samples every other one
+ * is dropped and the interval doubles, so a long run keeps an even picture of its whole length.
+ *
+ * Profiling costs a few increments per step. The engine only profiles when it is given a profile, and
+ * not in accelerated mode.
+*/
+class TMProfile
+{
+public:
+    enum {MaxExtentSamples = 4096};
+
+    //The visited tape after a given step:
+    struct ExtentSample
+    {
+        std::uint64_t step;
+        std::int64_t leftmost;
+        std::int64_t rightmost;
+    };
+
+    //Constructor:
+    TMProfile();
+
+    //Accessor functions:
+    int getNumStates() const;
+    int getNumSymbols() const;
+    std::uint64_t getSteps() const;
+    std::uint64_t getStateHits(int state) const;
+    std::uint64_t getTransitionHits(int state, TMSymbol symbol) const;
+    std::uint64_t getMoves(int direction) const;
+    std::uint64_t getCellVisits(std::int64_t position) const;
+    std::int64_t getLowestCell() const;
+    std::int64_t getHighestCell() const;
+    const std::vector<ExtentSample> &getExtentSamples() const;
+    std::uint64_t getSampleInterval() const;
+    std::int64_t getElapsedTime() const;
+    int getFinalState() const;
+    bool isEmpty() const;
+
+    //Mutator functions:
+    void clear();
+    void begin(const TMCompiledMachine &machine, const TMTape &tape, int state);
+    void finish(const TMTape &tape, int state, std::int64_t elapsedNanoseconds);
+
+    //Hot loop functions, kept inline:
+    void addStep(int state, TMSymbol symbol, std::int64_t head, int move, const TMTape &tape)
+    {
+        m_StateHits[state]++;
+        m_TransitionHits[static_cast<std::size_t>(state) * m_Stride + (symbol < m_NumSymbols ? symbol : m_NumSymbols)]++;
+        m_Moves[move + 1]++;
+
+        std::uint64_t cell = static_cast<std::uint64_t>(head - m_CellOrigin);
+        if(cell < m_CellVisits.size())
+            m_CellVisits[cell]++;
+        else
+            this->addCellVisit(head);
+
+        if(++m_Steps >= m_NextSample)
+            this->addExtentSample(tape);
+    }
+
+private:
+    void addCellVisit(std::int64_t head);
+    void addExtentSample(const TMTape &tape);
+
+    std::vector<std::uint64_t> m_StateHits;
+    std::vector<std::uint64_t> m_TransitionHits;
+    std::vector<std::uint64_t> m_CellVisits;
+    std::vector<ExtentSample> m_ExtentSamples;
+    std::uint64_t m_Moves[3];
+    std::uint64_t m_Steps;
+    std::uint64_t m_SampleInterval;
+    std::uint64_t m_NextSample;
+    std::int64_t m_CellOrigin;
+    std::int64_t m_ElapsedNanoseconds;
+    int m_NumSymbols;
+    int m_Stride;
+    int m_FinalState;
+    bool m_Started;
+};
+
+#endif // TMPROFILE_H
@@ -0,0 +1,104 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmrunconfig.h"
+
+TMRunConfig::TMRunConfig():
+    m_MaxSteps(DefaultMaxSteps), m_MaxTapeCells(DefaultMaxTapeCells), m_MaxWallTime(0),
+    m_MaxTraceMemory(0), m_CheckInterval(1 << 16), m_MaxConfigurations(DefaultMaxConfigurations),
+    m_CycleDetection(false), m_TranslatedCycleDetection(false)
+{
+}
+
+std::uint64_t TMRunConfig::getMaxSteps() const
+{
+    return m_MaxSteps;
+}
+
+std::uint64_t TMRunConfig::getMaxTapeCells() const
+{
+    return m_MaxTapeCells;
+}
+
+std::int64_t TMRunConfig::getMaxWallTime() const
+{
+    return m_MaxWallTime;
+}
+
+std::size_t TMRunConfig::getMaxTraceMemory() const
+{
+    return m_MaxTraceMemory;
+}
+
+std::uint64_t TMRunConfig::getCheckInterval() const
+{
+    return m_CheckInterval;
+}
+
+std::uint64_t TMRunConfig::getMaxConfigurations() const
+{
+    return m_MaxConfigurations;
+}
+
+bool TMRunConfig::isCycleDetectionEnabled() const
+{
+    return m_CycleDetection;
+}
+
+bool TMRunConfig::isTranslatedCycleDetectionEnabled() const
+{
+    return m_TranslatedCycleDetection;
+}
+
+void TMRunConfig::setMaxSteps(std::uint64_t steps)
+{
+    m_MaxSteps = steps;
+}
+
+void TMRunConfig::setMaxTapeCells(std::uint64_t cells)
+{
+    m_MaxTapeCells = cells;
+}
+
+void TMRunConfig::setMaxWallTime(std::int64_t milliseconds)
+{
+    m_MaxWallTime = milliseconds;
+}
+
+void TMRunConfig::setMaxTraceMemory(std::size_t bytes)
+{
+    m_MaxTraceMemory = bytes;
+}
+
+void TMRunConfig::setMaxConfigurations(std::uint64_t configurations)
+{
+    m_MaxConfigurations = configurations;
+}
+
+void TMRunConfig::setCheckInterval(std::uint64_t steps)
+{
+    //A zero interval would never reach a check:
+    m_CheckInterval = steps > 0 ? steps : 1;
+}
+
+void TMRunConfig::setCycleDetectionEnabled(bool enabled)
+{
+    m_CycleDetection = enabled;
+}
+
+void TMRunConfig::setTranslatedCycleDetectionEnabled(bool enabled)
+{
+    m_TranslatedCycleDetection = enabled;
+}
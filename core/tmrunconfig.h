@@ -0,0 +1,70 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMRUNCONFIG_H
+#define TMRUNCONFIG_H
+
+#include <cstddef>
+#include <cstdint>
+
+/* The budget for a single run. A limit of 0 means unlimited.
+ * Cycle detection is off by default; when on, a run that repeats a configuration stops early.
+ * Translated cycle detection also stops runs that repeat the same behaviour while drifting along the tape.
+ * Nondeterministic runs also stop once they have explored getMaxConfigurations() distinct configurations.
+ *
+ * Steps and tape cells are checked on every step of the run loop; wall time and trace memory are
+ * checked every getCheckInterval() steps. Wall time only counts time spent inside the run loop, so
+ * a paused run does not use up its budget.
+*/
+class TMRunConfig
+{
+public:
+    enum {DefaultMaxSteps = 100000000, DefaultMaxTapeCells = 1 << 26, DefaultMaxConfigurations = 1 << 20};
+
+    //Constructor:
+    TMRunConfig();
+
+    //Accessor functions:
+    std::uint64_t getMaxSteps() const;
+    std::uint64_t getMaxTapeCells() const;
+    std::int64_t getMaxWallTime() const;
+    std::size_t getMaxTraceMemory() const;
+    std::uint64_t getCheckInterval() const;
+    std::uint64_t getMaxConfigurations() const;
+    bool isCycleDetectionEnabled() const;
+    bool isTranslatedCycleDetectionEnabled() const;
+
+    //Mutator functions:
+    void setMaxSteps(std::uint64_t steps);
+    void setMaxTapeCells(std::uint64_t cells);
+    void setMaxWallTime(std::int64_t milliseconds);
+    void setMaxTraceMemory(std::size_t bytes);
+    void setCheckInterval(std::uint64_t steps);
+    void setMaxConfigurations(std::uint64_t configurations);
+    void setCycleDetectionEnabled(bool enabled);
+    void setTranslatedCycleDetectionEnabled(bool enabled);
+
+private:
+    std::uint64_t m_MaxSteps;
+    std::uint64_t m_MaxTapeCells;
+    std::int64_t m_MaxWallTime;
+    std::size_t m_MaxTraceMemory;
+    std::uint64_t m_CheckInterval;
+    std::uint64_t m_MaxConfigurations;
+    bool m_CycleDetection;
+    bool m_TranslatedCycleDetection;
+};
+
+#endif // TMRUNCONFIG_H
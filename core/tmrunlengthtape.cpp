@@ -0,0 +1,102 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmrunlengthtape.h"
+
+TMRunLengthTape::TMRunLengthTape(TMSymbol blank):
+    m_Blank(blank)
+{
+    this->clear();
+}
+
+TMSymbol TMRunLengthTape::getBlank() const
+{
+    return m_Blank;
+}
+
+std::int64_t TMRunLengthTape::getHeadPosition() const
+{
+    return m_Position;
+}
+
+std::int64_t TMRunLengthTape::getLeftmost() const
+{
+    return m_Leftmost;
+}
+
+std::int64_t TMRunLengthTape::getRightmost() const
+{
+    return m_Rightmost;
+}
+
+std::size_t TMRunLengthTape::getNumRuns() const
+{
+    return m_Left.size() + m_Right.size() + 1;
+}
+
+std::size_t TMRunLengthTape::getMemoryUsage() const
+{
+    return (m_Left.capacity() + m_Right.capacity()) * sizeof(Run);
+}
+
+void TMRunLengthTape::toTape(TMTape &tape) const
+{
+    tape.clear();
+
+    //Left of the head, from the head outwards:
+    std::int64_t position = m_Position - 1;
+    for(auto run = m_Left.rbegin(); run != m_Left.rend(); ++run)
+    {
+        for(std::uint64_t i = 0; i < run->length; i++)
+            tape.set(position--, run->symbol);
+    }
+
+    //The head and right of it:
+    tape.set(m_Position, m_Head);
+    position = m_Position + 1;
+    for(auto run = m_Right.rbegin(); run != m_Right.rend(); ++run)
+    {
+        for(std::uint64_t i = 0; i < run->length; i++)
+            tape.set(position++, run->symbol);
+    }
+
+    //Blank cells that were visited still count towards the extent:
+    tape.setHeadPosition(m_Leftmost);
+    tape.setHeadPosition(m_Rightmost);
+    tape.setHeadPosition(m_Position);
+}
+
+void TMRunLengthTape::clear()
+{
+    m_Left.clear();
+    m_Right.clear();
+    m_Position = 0;
+    m_Leftmost = 0;
+    m_Rightmost = 0;
+    m_Head = m_Blank;
+}
+
+void TMRunLengthTape::load(const std::vector<TMSymbol> &cells)
+{
+    this->clear();
+    if(cells.empty())
+        return;
+
+    //The head starts on the first cell; the rest goes on the right stack, last cell at the bottom:
+    m_Head = cells[0];
+    for(std::size_t i = cells.size() - 1; i > 0; i--)
+        push(m_Right, cells[i], 1, m_Blank);
+    m_Rightmost = static_cast<std::int64_t>(cells.size()) - 1;
+}
@@ -0,0 +1,165 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMRUNLENGTHTAPE_H
+#define TMRUNLENGTHTAPE_H
+
+#include "tmtape.h"
+#include "tmtypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* A tape stored as runs of identical symbols, for the engine's accelerated mode.
+ *
+ * The cells left and right of the head are kept as two stacks of runs with the run next to the head
+ * on top, so moving the head or sweeping it across a whole run is O(1). Blank cells past the last
+ * run on either side are not stored. The visited extent is tracked the same way as TMTape does it,
+ * and toTape() writes the tape out cell by cell.
+*/
+class TMRunLengthTape
+{
+public:
+    struct Run
+    {
+        TMSymbol symbol;
+        std::uint64_t length;
+    };
+
+    enum : std::uint64_t {Unbounded = ~std::uint64_t(0)};
+
+    //Constructor:
+    explicit TMRunLengthTape(TMSymbol blank = 0);
+
+    //Accessor functions:
+    TMSymbol getBlank() const;
+    std::int64_t getHeadPosition() const;
+    std::int64_t getLeftmost() const;
+    std::int64_t getRightmost() const;
+    std::size_t getNumRuns() const;
+    std::size_t getMemoryUsage() const;
+    void toTape(TMTape &tape) const;
+
+    //Mutator functions:
+    void clear();
+    void load(const std::vector<TMSymbol> &cells);
+
+    //Hot loop functions, kept inline:
+    TMSymbol read() const
+    {
+        return m_Head;
+    }
+
+    void write(TMSymbol symbol)
+    {
+        m_Head = symbol;
+    }
+
+    void move(int direction)
+    {
+        if(direction > 0)
+            this->shift(m_Left, m_Right);
+        else if(direction < 0)
+            this->shift(m_Right, m_Left);
+        else
+            return;
+
+        m_Position += direction;
+        if(m_Position > m_Rightmost)
+            m_Rightmost = m_Position;
+        else if(m_Position < m_Leftmost)
+            m_Leftmost = m_Position;
+    }
+
+    //Returns how many cells from the head on in the given direction hold the head's symbol, or Unbounded:
+    std::uint64_t getRunLength(int direction) const
+    {
+        const std::vector<Run> &ahead = direction > 0 ? m_Right : m_Left;
+        if(ahead.empty())
+            return m_Head == m_Blank ? Unbounded : 1;
+        if(ahead.back().symbol != m_Head)
+            return 1;
+        if(ahead.size() == 1 && m_Head == m_Blank)
+            return Unbounded;
+        return ahead.back().length + 1;
+    }
+
+    //Writes the symbol to the next count cells from the head on, which must all hold the head's symbol, and moves past them:
+    void sweep(int direction, std::uint64_t count, TMSymbol symbol)
+    {
+        std::vector<Run> &behind = direction > 0 ? m_Left : m_Right;
+        std::vector<Run> &ahead = direction > 0 ? m_Right : m_Left;
+
+        push(behind, symbol, count, m_Blank);
+        pop(ahead, count - 1);
+        m_Head = take(ahead, m_Blank);
+
+        m_Position += direction > 0 ? static_cast<std::int64_t>(count) : -static_cast<std::int64_t>(count);
+        if(m_Position > m_Rightmost)
+            m_Rightmost = m_Position;
+        else if(m_Position < m_Leftmost)
+            m_Leftmost = m_Position;
+    }
+
+private:
+    void shift(std::vector<Run> &behind, std::vector<Run> &ahead)
+    {
+        push(behind, m_Head, 1, m_Blank);
+        m_Head = take(ahead, m_Blank);
+    }
+
+    static void push(std::vector<Run> &side, TMSymbol symbol, std::uint64_t count, TMSymbol blank)
+    {
+        if(!side.empty() && side.back().symbol == symbol)
+            side.back().length += count;
+        else if(!side.empty() || symbol != blank)
+            side.push_back(Run{symbol, count});
+    }
+
+    static void pop(std::vector<Run> &side, std::uint64_t count)
+    {
+        //Cells past the last run are blank and are not stored:
+        while(count > 0 && !side.empty())
+        {
+            if(side.back().length > count)
+            {
+                side.back().length -= count;
+                return;
+            }
+            count -= side.back().length;
+            side.pop_back();
+        }
+    }
+
+    static TMSymbol take(std::vector<Run> &side, TMSymbol blank)
+    {
+        if(side.empty())
+            return blank;
+        TMSymbol symbol = side.back().symbol;
+        if(--side.back().length == 0)
+            side.pop_back();
+        return symbol;
+    }
+
+    std::vector<Run> m_Left;
+    std::vector<Run> m_Right;
+    std::int64_t m_Position;
+    std::int64_t m_Leftmost;
+    std::int64_t m_Rightmost;
+    TMSymbol m_Head;
+    TMSymbol m_Blank;
+};
+
+#endif // TMRUNLENGTHTAPE_H
@@ -0,0 +1,119 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmsharedtape.h"
+#include <algorithm>
+
+TMSharedTape::TMSharedTape():
+    m_FirstChunk(0), m_Head(0), m_Leftmost(0), m_Rightmost(0), m_Hash(0)
+{
+}
+
+std::int64_t TMSharedTape::getHeadPosition() const
+{
+    return m_Head;
+}
+
+std::int64_t TMSharedTape::getLeftmost() const
+{
+    return m_Leftmost;
+}
+
+std::int64_t TMSharedTape::getRightmost() const
+{
+    return m_Rightmost;
+}
+
+std::uint64_t TMSharedTape::getHash() const
+{
+    return m_Hash;
+}
+
+TMSymbol TMSharedTape::at(std::int64_t position) const
+{
+    std::int64_t index = (position >> ChunkBits) - m_FirstChunk;
+    if(index < 0 || index >= static_cast<std::int64_t>(m_Chunks.size()) || !m_Chunks[index])
+        return 0;
+    return (*m_Chunks[index])[position & (ChunkSize - 1)];
+}
+
+bool TMSharedTape::equals(const TMSharedTape &other) const
+{
+    if(m_Head != other.m_Head || m_Hash != other.m_Hash)
+        return false;
+
+    //Compare chunk by chunk; shared chunks are equal without looking at them:
+    std::int64_t first = std::min(m_FirstChunk, other.m_FirstChunk);
+    std::int64_t last = std::max(m_FirstChunk + static_cast<std::int64_t>(m_Chunks.size()),
+                                 other.m_FirstChunk + static_cast<std::int64_t>(other.m_Chunks.size()));
+    for(std::int64_t chunk = first; chunk < last; chunk++)
+    {
+        std::int64_t a = chunk - m_FirstChunk;
+        std::int64_t b = chunk - other.m_FirstChunk;
+        const Chunk *ca = a >= 0 && a < static_cast<std::int64_t>(m_Chunks.size()) ? m_Chunks[a].get() : nullptr;
+        const Chunk *cb = b >= 0 && b < static_cast<std::int64_t>(other.m_Chunks.size()) ? other.m_Chunks[b].get() : nullptr;
+        if(ca == cb)
+            continue;
+        for(int i = 0; i < ChunkSize; i++)
+        {
+            if((ca ? (*ca)[i] : 0) != (cb ? (*cb)[i] : 0))
+                return false;
+        }
+    }
+    return true;
+}
+
+void TMSharedTape::load(const std::vector<TMSymbol> &cells)
+{
+    m_Chunks.clear();
+    m_FirstChunk = 0;
+    m_Head = 0;
+    m_Hash = 0;
+    for(std::size_t i = 0; i < cells.size(); i++)
+    {
+        m_Head = static_cast<std::int64_t>(i);
+        this->write(cells[i]);
+    }
+    m_Head = 0;
+    m_Leftmost = 0;
+    m_Rightmost = cells.empty() ? 0 : static_cast<std::int64_t>(cells.size()) - 1;
+}
+
+TMSharedTape::Chunk &TMSharedTape::uniqueChunk(std::int64_t position)
+{
+    //Grow the chunk list to cover the position:
+    std::int64_t chunk = position >> ChunkBits;
+    if(m_Chunks.empty())
+        m_FirstChunk = chunk;
+    if(chunk < m_FirstChunk)
+    {
+        m_Chunks.insert(m_Chunks.begin(), static_cast<std::size_t>(m_FirstChunk - chunk), nullptr);
+        m_FirstChunk = chunk;
+    }
+    std::size_t index = static_cast<std::size_t>(chunk - m_FirstChunk);
+    if(index >= m_Chunks.size())
+        m_Chunks.resize(index + 1);
+
+    //Copy a chunk that another tape still shares before changing it:
+    std::shared_ptr<Chunk> &slot = m_Chunks[index];
+    if(!slot)
+    {
+        slot = std::make_shared<Chunk>();
+        slot->fill(0);
+    }
+    else if(slot.use_count() > 1)
+        slot = std::make_shared<Chunk>(*slot);
+    return *slot;
+}
@@ -0,0 +1,89 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMSHAREDTAPE_H
+#define TMSHAREDTAPE_H
+
+#include "tmcycledetector.h"
+#include "tmtypes.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* A tape whose chunks are shared between copies until one of them writes (copy-on-write).
+ *
+ * Copying a TMSharedTape only copies the chunk pointers, so the branches of a nondeterministic run
+ * can each own a tape without copying cells they never change. Chunks are small and are only created
+ * by writes; cells in missing chunks read as blank. The tape keeps an order-independent hash of its
+ * contents, updated on every write, so configurations can be compared by hash first.
+*/
+class TMSharedTape
+{
+public:
+    enum {ChunkBits = 6, ChunkSize = 1 << ChunkBits};
+
+    //Constructor:
+    TMSharedTape();
+
+    //Accessor functions:
+    std::int64_t getHeadPosition() const;
+    std::int64_t getLeftmost() const;
+    std::int64_t getRightmost() const;
+    std::uint64_t getHash() const;
+    TMSymbol at(std::int64_t position) const;
+    bool equals(const TMSharedTape &other) const;
+
+    //Mutator functions:
+    void load(const std::vector<TMSymbol> &cells);
+
+    //Hot loop functions, kept inline:
+    TMSymbol read() const
+    {
+        return this->at(m_Head);
+    }
+
+    void write(TMSymbol symbol)
+    {
+        TMSymbol old = this->read();
+        if(old == symbol)
+            return;
+        this->uniqueChunk(m_Head)[m_Head & (ChunkSize - 1)] = symbol;
+        m_Hash += TMCycleDetector::cellHash(m_Head, symbol) - TMCycleDetector::cellHash(m_Head, old);
+    }
+
+    void move(int direction)
+    {
+        m_Head += direction;
+        if(m_Head > m_Rightmost)
+            m_Rightmost = m_Head;
+        else if(m_Head < m_Leftmost)
+            m_Leftmost = m_Head;
+    }
+
+private:
+    typedef std::array<TMSymbol, ChunkSize> Chunk;
+
+    Chunk &uniqueChunk(std::int64_t position);
+
+    std::vector<std::shared_ptr<Chunk>> m_Chunks; //m_Chunks[i] holds chunk number m_FirstChunk + i
+    std::int64_t m_FirstChunk;
+    std::int64_t m_Head;
+    std::int64_t m_Leftmost;
+    std::int64_t m_Rightmost;
+    std::uint64_t m_Hash;
+};
+
+#endif // TMSHAREDTAPE_H
@@ -0,0 +1,138 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmsymboltable.h"
+#include <algorithm>
+
+//Length in bytes of the UTF-8 sequence starting with the given lead byte:
+static std::size_t utf8Length(unsigned char lead)
+{
+    if(lead >= 0xF0)
+        return 4;
+    if(lead >= 0xE0)
+        return 3;
+    if(lead >= 0xC0)
+        return 2;
+    return 1;
+}
+
+static bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+TMSymbolTable::TMSymbolTable(): m_Overflowed(false)
+{
+    this->clear();
+}
+
+int TMSymbolTable::getNumSymbols() const
+{
+    return static_cast<int>(m_Names.size());
+}
+
+int TMSymbolTable::find(const std::string &name) const
+{
+    auto it = m_Ids.find(name);
+    if(it == m_Ids.end())
+        return -1;
+    return it->second;
+}
+
+const std::string &TMSymbolTable::getName(TMSymbol symbol) const
+{
+    static const std::string unknown = "?";
+    if(symbol < m_Names.size())
+        return m_Names[symbol];
+    return unknown;
+}
+
+std::vector<std::string> TMSymbolTable::tokenize(const std::string &input) const
+{
+    std::vector<std::string> tokens;
+    std::string candidate;
+    std::size_t i = 0;
+    while(i < input.size())
+    {
+        if(isSpace(input[i]))
+        {
+            i++;
+            continue;
+        }
+
+        //The token may not run into the next whitespace:
+        std::size_t end = i;
+        while(end < input.size() && !isSpace(input[end]))
+            end++;
+
+        //Try the known symbol lengths from the longest down. A cut inside a UTF-8 sequence never matches:
+        std::size_t length = 0;
+        std::size_t longest = std::min(end - i, m_HasLength.size() - 1);
+        for(std::size_t n = longest; n > 0 && length == 0; n--)
+        {
+            if(!m_HasLength[n])
+                continue;
+            candidate.assign(input, i, n);
+            if(m_Ids.count(candidate))
+                length = n;
+        }
+
+        //Unknown: take one character:
+        if(length == 0)
+            length = std::min(utf8Length(static_cast<unsigned char>(input[i])), end - i);
+
+        tokens.emplace_back(input, i, length);
+        i += length;
+    }
+    return tokens;
+}
+
+bool TMSymbolTable::hasOverflowed() const
+{
+    return m_Overflowed;
+}
+
+void TMSymbolTable::clear()
+{
+    m_Names.clear();
+    m_Ids.clear();
+    m_HasLength.assign(1, false);
+    m_Overflowed = false;
+
+    //The blank symbol is always id 0:
+    this->intern("-");
+}
+
+TMSymbol TMSymbolTable::intern(const std::string &name)
+{
+    auto it = m_Ids.find(name);
+    if(it != m_Ids.end())
+        return it->second;
+
+    //Another id would wrap around to the blank:
+    if(m_Names.size() >= MaxSymbols)
+    {
+        m_Overflowed = true;
+        return 0;
+    }
+
+    TMSymbol id = static_cast<TMSymbol>(m_Names.size());
+    m_Names.push_back(name);
+    m_Ids.emplace(name, id);
+    if(name.size() >= m_HasLength.size())
+        m_HasLength.resize(name.size() + 1, false);
+    m_HasLength[name.size()] = true;
+    return id;
+}
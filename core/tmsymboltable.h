@@ -0,0 +1,62 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMSYMBOLTABLE_H
+#define TMSYMBOLTABLE_H
+
+#include "tmtypes.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* Interns tape symbol names into dense ids.
+ *
+ * A symbol name is any non-empty UTF-8 string without whitespace or commas: a single letter, a
+ * multi-character token such as "x12" or a non-ASCII character. Id 0 is always the blank symbol '-'.
+ * Ids are what the tape stores and what the compiled engine compares, so a TMSymbol can hold up to
+ * 65536 distinct symbols. Once the table is full intern() returns the blank and hasOverflowed() turns
+ * true; TuringMachine::build() checks it and fails.
+ *
+ * tokenize() splits an input string into symbols. Whitespace always separates symbols; within a run
+ * of non-whitespace the longest known symbol is taken at each position, and anything unknown is read
+ * one character at a time.
+*/
+class TMSymbolTable
+{
+public:
+    enum {MaxSymbols = 65536};
+
+    //Constructor:
+    TMSymbolTable();
+
+    //Accessor functions:
+    int getNumSymbols() const;
+    int find(const std::string &name) const;
+    const std::string &getName(TMSymbol symbol) const;
+    std::vector<std::string> tokenize(const std::string &input) const;
+    bool hasOverflowed() const;
+
+    //Mutator functions:
+    void clear();
+    TMSymbol intern(const std::string &name);
+
+private:
+    std::vector<std::string> m_Names;
+    std::unordered_map<std::string, TMSymbol> m_Ids;
+    std::vector<bool> m_HasLength; //m_HasLength[n] is true if some symbol is n bytes long
+    bool m_Overflowed;
+};
+
+#endif // TMSYMBOLTABLE_H
@@ -0,0 +1,151 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmtape.h"
+#include <algorithm>
+
+TMTape::TMTape(TMSymbol blank):
+    m_Chunk(nullptr), m_Blank(blank)
+{
+    this->clear();
+}
+
+TMSymbol TMTape::getBlank() const
+{
+    return m_Blank;
+}
+
+std::int64_t TMTape::getHeadPosition() const
+{
+    return m_Position;
+}
+
+std::int64_t TMTape::getLeftmost() const
+{
+    return m_Leftmost;
+}
+
+std::int64_t TMTape::getRightmost() const
+{
+    return m_Rightmost;
+}
+
+TMSymbol TMTape::at(std::int64_t position) const
+{
+    const TMSymbol *chunk = this->findChunk(position >> ChunkBits);
+    if(chunk == nullptr)
+        return m_Blank;
+    return chunk[position & (ChunkSize - 1)];
+}
+
+std::vector<TMSymbol> TMTape::getCells(std::int64_t from, std::int64_t to) const
+{
+    std::vector<TMSymbol> cells;
+    if(to < from)
+        return cells;
+
+    cells.reserve(static_cast<std::size_t>(to - from + 1));
+    for(std::int64_t i = from; i <= to; i++)
+        cells.push_back(this->at(i));
+    return cells;
+}
+
+std::size_t TMTape::getNumChunks() const
+{
+    return m_NumChunks;
+}
+
+std::size_t TMTape::getMemoryUsage() const
+{
+    return m_NumChunks * ChunkSize * sizeof(TMSymbol) + (m_Right.capacity() + m_Left.capacity()) * sizeof(Chunk);
+}
+
+void TMTape::clear()
+{
+    m_Right.clear();
+    m_Left.clear();
+    m_NumChunks = 0;
+    m_Position = 0;
+    m_Leftmost = 0;
+    m_Rightmost = 0;
+    m_Offset = 0;
+    m_Chunk = this->getChunk(0);
+}
+
+void TMTape::load(const std::vector<TMSymbol> &cells, std::int64_t start)
+{
+    this->clear();
+    for(std::size_t i = 0; i < cells.size(); i++)
+        this->set(start + static_cast<std::int64_t>(i), cells[i]);
+    this->setHeadPosition(0);
+}
+
+void TMTape::set(std::int64_t position, TMSymbol symbol)
+{
+    TMSymbol *chunk = this->getChunk(position >> ChunkBits);
+    chunk[position & (ChunkSize - 1)] = symbol;
+    m_Leftmost = std::min(m_Leftmost, position);
+    m_Rightmost = std::max(m_Rightmost, position);
+}
+
+void TMTape::setHeadPosition(std::int64_t position)
+{
+    m_Position = position;
+    m_Offset = static_cast<int>(position & (ChunkSize - 1));
+    m_Chunk = this->getChunk(position >> ChunkBits);
+    m_Leftmost = std::min(m_Leftmost, position);
+    m_Rightmost = std::max(m_Rightmost, position);
+}
+
+TMSymbol *TMTape::findChunk(std::int64_t chunkIndex) const
+{
+    //Chunk 0 and up live in m_Right, chunk -1 and down live in m_Left:
+    if(chunkIndex >= 0)
+    {
+        if(chunkIndex < static_cast<std::int64_t>(m_Right.size()))
+            return m_Right[chunkIndex].get();
+    }
+    else
+    {
+        std::int64_t index = -chunkIndex - 1;
+        if(index < static_cast<std::int64_t>(m_Left.size()))
+            return m_Left[index].get();
+    }
+    return nullptr;
+}
+
+TMSymbol *TMTape::getChunk(std::int64_t chunkIndex)
+{
+    std::vector<Chunk> &side = chunkIndex >= 0 ? m_Right : m_Left;
+    std::size_t index = static_cast<std::size_t>(chunkIndex >= 0 ? chunkIndex : -chunkIndex - 1);
+
+    if(index >= side.size())
+        side.resize(index + 1);
+
+    //Allocate the chunk the first time it is reached:
+    if(!side[index])
+    {
+        side[index].reset(new TMSymbol[ChunkSize]);
+        std::fill(side[index].get(), side[index].get() + ChunkSize, m_Blank);
+        m_NumChunks++;
+    }
+    return side[index].get();
+}
+
+void TMTape::enterChunk()
+{
+    m_Offset = static_cast<int>(m_Position & (ChunkSize - 1));
+    m_Chunk = this->getChunk(m_Position >> ChunkBits);
+}
@@ -0,0 +1,97 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMTAPE_H
+#define TMTAPE_H
+
+#include "tmtypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/* A tape that is unbounded in both directions.
+ *
+ * Cells are stored in fixed-size chunks that are only allocated once the head (or a write) reaches
+ * them, so memory grows with the cells actually touched. Chunks to the right of cell 0 and chunks to
+ * the left of it are kept in two separate lists; growing either list only moves chunk pointers,
+ * never the cells themselves. The head caches a pointer to its chunk so a move is O(1).
+*/
+class TMTape
+{
+public:
+    enum {ChunkBits = 12, ChunkSize = 1 << ChunkBits};
+
+    //Constructor:
+    explicit TMTape(TMSymbol blank = 0);
+
+    //Accessor functions:
+    TMSymbol getBlank() const;
+    std::int64_t getHeadPosition() const;
+    std::int64_t getLeftmost() const;
+    std::int64_t getRightmost() const;
+    TMSymbol at(std::int64_t position) const;
+    std::vector<TMSymbol> getCells(std::int64_t from, std::int64_t to) const;
+    std::size_t getNumChunks() const;
+    std::size_t getMemoryUsage() const;
+
+    //Mutator functions:
+    void clear();
+    void load(const std::vector<TMSymbol> &cells, std::int64_t start = 0);
+    void set(std::int64_t position, TMSymbol symbol);
+    void setHeadPosition(std::int64_t position);
+
+    //Hot loop functions, kept inline:
+    TMSymbol read() const
+    {
+        return m_Chunk[m_Offset];
+    }
+
+    void write(TMSymbol symbol)
+    {
+        m_Chunk[m_Offset] = symbol;
+    }
+
+    void move(int direction)
+    {
+        m_Position += direction;
+        m_Offset += direction;
+        if(m_Offset < 0 || m_Offset >= ChunkSize)
+            this->enterChunk();
+        if(m_Position > m_Rightmost)
+            m_Rightmost = m_Position;
+        else if(m_Position < m_Leftmost)
+            m_Leftmost = m_Position;
+    }
+
+private:
+    typedef std::unique_ptr<TMSymbol[]> Chunk;
+
+    TMSymbol *findChunk(std::int64_t chunkIndex) const;
+    TMSymbol *getChunk(std::int64_t chunkIndex);
+    void enterChunk();
+
+    std::vector<Chunk> m_Right;
+    std::vector<Chunk> m_Left;
+    TMSymbol *m_Chunk;
+    std::int64_t m_Position;
+    std::int64_t m_Leftmost;
+    std::int64_t m_Rightmost;
+    std::size_t m_NumChunks;
+    int m_Offset;
+    TMSymbol m_Blank;
+};
+
+#endif // TMTAPE_H
@@ -0,0 +1,172 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmtrace.h"
+#include <algorithm>
+
+TMSymbol TMTraceSnapshot::at(std::int64_t position) const
+{
+    std::int64_t index = position - leftmost;
+    if(index < 0 || index >= static_cast<std::int64_t>(cells.size()))
+        return 0;
+    return cells[static_cast<std::size_t>(index)];
+}
+
+void TMTraceSnapshot::writeCell(std::int64_t position, TMSymbol symbol)
+{
+    if(position < leftmost)
+    {
+        cells.insert(cells.begin(), static_cast<std::size_t>(leftmost - position), 0);
+        leftmost = position;
+    }
+    std::size_t index = static_cast<std::size_t>(position - leftmost);
+    if(index >= cells.size())
+        cells.resize(index + 1, 0);
+    cells[index] = symbol;
+}
+
+void TMTraceSnapshot::applyStep(const TMTraceStep &d)
+{
+    this->writeCell(d.head, d.newSymbol);
+    head = d.head + d.move;
+    state = d.toState;
+    step++;
+}
+
+void TMTraceSnapshot::undoStep(const TMTraceStep &d)
+{
+    this->writeCell(d.head, d.oldSymbol);
+    head = d.head;
+    state = d.fromState;
+    step--;
+}
+
+TMTrace::TMTrace():
+    m_KeyframeBytes(0), m_NextKeyframe(0), m_KeyframeInterval(1024), m_FinalState(0)
+{
+}
+
+std::uint64_t TMTrace::getNumSteps() const
+{
+    return m_Steps.size();
+}
+
+const TMTraceStep &TMTrace::getStep(std::uint64_t step) const
+{
+    return m_Steps[static_cast<std::size_t>(step)];
+}
+
+int TMTrace::getStateAt(std::uint64_t step) const
+{
+    if(step < m_Steps.size())
+        return m_Steps[static_cast<std::size_t>(step)].fromState;
+    return m_FinalState;
+}
+
+std::int64_t TMTrace::getHeadAt(std::uint64_t step) const
+{
+    //The head before a step is recorded with it; after the last step it is where that step moved it:
+    if(step < m_Steps.size())
+        return m_Steps[static_cast<std::size_t>(step)].head;
+    if(!m_Steps.empty())
+        return m_Steps.back().head + m_Steps.back().move;
+    return m_Keyframes.empty() ? 0 : m_Keyframes.front().head;
+}
+
+int TMTrace::getFinalState() const
+{
+    return m_FinalState;
+}
+
+int TMTrace::getNumKeyframes() const
+{
+    return static_cast<int>(m_Keyframes.size());
+}
+
+int TMTrace::getKeyframeInterval() const
+{
+    return m_KeyframeInterval;
+}
+
+TMTraceSnapshot TMTrace::getSnapshot(std::uint64_t step) const
+{
+    if(m_Keyframes.empty())
+        return TMTraceSnapshot{0, 0, 0, std::vector<TMSymbol>(), m_FinalState};
+
+    step = std::min<std::uint64_t>(step, m_Steps.size());
+
+    //Find the last keyframe at or before the step:
+    auto it = std::upper_bound(m_Keyframes.begin(), m_Keyframes.end(), step,
+                               [](std::uint64_t s, const TMTraceSnapshot &k) { return s < k.step; });
+    TMTraceSnapshot snapshot = *(it - 1);
+
+    //Replay the deltas from the keyframe:
+    while(snapshot.step < step)
+        snapshot.applyStep(m_Steps[static_cast<std::size_t>(snapshot.step)]);
+    snapshot.state = this->getStateAt(step);
+    return snapshot;
+}
+
+std::size_t TMTrace::getMemoryUsage() const
+{
+    return m_Steps.capacity() * sizeof(TMTraceStep) + m_Keyframes.capacity() * sizeof(TMTraceSnapshot) + m_KeyframeBytes;
+}
+
+bool TMTrace::isEmpty() const
+{
+    return m_Keyframes.empty();
+}
+
+void TMTrace::clear()
+{
+    m_Steps.clear();
+    m_Keyframes.clear();
+    m_KeyframeBytes = 0;
+    m_NextKeyframe = 0;
+    m_FinalState = 0;
+}
+
+void TMTrace::setKeyframeInterval(int interval)
+{
+    m_KeyframeInterval = std::max(1, interval);
+}
+
+void TMTrace::begin(const TMTape &tape, int state)
+{
+    this->clear();
+    m_FinalState = state;
+    this->addKeyframe(tape, state);
+}
+
+void TMTrace::finish(int state)
+{
+    m_FinalState = state;
+}
+
+void TMTrace::addKeyframe(const TMTape &tape, int state)
+{
+    TMTraceSnapshot keyframe;
+    keyframe.step = m_Steps.size();
+    keyframe.head = tape.getHeadPosition();
+    keyframe.leftmost = tape.getLeftmost();
+    keyframe.cells = tape.getCells(tape.getLeftmost(), tape.getRightmost());
+    keyframe.state = state;
+    m_KeyframeBytes += keyframe.cells.capacity() * sizeof(TMSymbol);
+
+    //Space keyframes out by at least the tape extent so they cost no more than the deltas:
+    std::uint64_t extent = static_cast<std::uint64_t>(keyframe.cells.size());
+    m_NextKeyframe = keyframe.step + std::max<std::uint64_t>(extent, m_KeyframeInterval);
+    m_Keyframes.push_back(std::move(keyframe));
+}
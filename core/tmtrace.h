@@ -0,0 +1,101 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMTRACE_H
+#define TMTRACE_H
+
+#include "tmtape.h"
+#include "tmtypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//One executed transition. The step number is the index of the entry in the trace:
+struct TMTraceStep
+{
+    std::int64_t head;
+    std::int32_t fromState;
+    std::int32_t toState;
+    TMSymbol oldSymbol;
+    TMSymbol newSymbol;
+    std::int8_t move;
+};
+
+//The full machine configuration before a given step. applyStep() and undoStep() move it one step
+//along its trace, growing the visited tape as cells are written:
+struct TMTraceSnapshot
+{
+    std::uint64_t step;
+    std::int64_t head;
+    std::int64_t leftmost;
+    std::vector<TMSymbol> cells;
+    int state;
+
+    TMSymbol at(std::int64_t position) const;
+    void writeCell(std::int64_t position, TMSymbol symbol);
+    void applyStep(const TMTraceStep &d);
+    void undoStep(const TMTraceStep &d);
+};
+
+/* An execution trace made of per-step deltas plus periodic keyframes.
+ *
+ * A keyframe is a copy of the visited part of the tape. One is taken at step 0 and then whenever
+ * the number of steps since the last keyframe reaches the tape extent (and at least
+ * getKeyframeInterval()), so keyframes never take more memory than the deltas they cover.
+ * getSnapshot() rebuilds the tape at any step from the nearest keyframe before it.
+*/
+class TMTrace
+{
+public:
+    //Constructor:
+    TMTrace();
+
+    //Accessor functions:
+    std::uint64_t getNumSteps() const;
+    const TMTraceStep &getStep(std::uint64_t step) const;
+    int getStateAt(std::uint64_t step) const;
+    std::int64_t getHeadAt(std::uint64_t step) const;
+    int getFinalState() const;
+    int getNumKeyframes() const;
+    int getKeyframeInterval() const;
+    TMTraceSnapshot getSnapshot(std::uint64_t step) const;
+    std::size_t getMemoryUsage() const;
+    bool isEmpty() const;
+
+    //Mutator functions:
+    void clear();
+    void setKeyframeInterval(int interval);
+    void begin(const TMTape &tape, int state);
+    void finish(int state);
+
+    void addStep(const TMTraceStep &step, const TMTape &tape)
+    {
+        m_Steps.push_back(step);
+        if(m_Steps.size() >= m_NextKeyframe)
+            this->addKeyframe(tape, step.toState);
+    }
+
+private:
+    void addKeyframe(const TMTape &tape, int state);
+
+    std::vector<TMTraceStep> m_Steps;
+    std::vector<TMTraceSnapshot> m_Keyframes;
+    std::size_t m_KeyframeBytes;
+    std::uint64_t m_NextKeyframe;
+    int m_KeyframeInterval;
+    int m_FinalState;
+};
+
+#endif // TMTRACE_H
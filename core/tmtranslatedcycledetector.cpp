@@ -0,0 +1,127 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmtranslatedcycledetector.h"
+#include <algorithm>
+
+TMTranslatedCycleDetector::TMTranslatedCycleDetector()
+{
+    this->clear();
+}
+
+bool TMTranslatedCycleDetector::isStarted() const
+{
+    return m_Started;
+}
+
+bool TMTranslatedCycleDetector::hasCycle() const
+{
+    return m_Found;
+}
+
+std::uint64_t TMTranslatedCycleDetector::getPeriod() const
+{
+    return m_Period;
+}
+
+std::int64_t TMTranslatedCycleDetector::getOffset() const
+{
+    return m_Offset;
+}
+
+std::uint64_t TMTranslatedCycleDetector::getCycleStart() const
+{
+    return m_CycleStart;
+}
+
+void TMTranslatedCycleDetector::clear()
+{
+    m_NextRecord[Right] = m_NextRecord[Left] = 0;
+    m_NumRecords[Right] = m_NumRecords[Left] = 0;
+    m_Rightmost = m_Leftmost = 0;
+    m_RightReach = m_LeftReach = 0;
+    m_Period = 0;
+    m_Offset = 0;
+    m_CycleStart = 0;
+    m_Started = false;
+    m_Found = false;
+}
+
+void TMTranslatedCycleDetector::begin(const TMTape &tape)
+{
+    this->clear();
+
+    //The record buffers are only allocated for runs that use them:
+    for(std::vector<Record> &records : m_Records)
+    {
+        records.resize(History);
+        for(Record &record : records)
+            record.cells.resize(Window);
+    }
+
+    m_Rightmost = tape.getRightmost();
+    m_Leftmost = tape.getLeftmost();
+    m_RightReach = m_LeftReach = tape.getHeadPosition();
+    m_Started = true;
+}
+
+bool TMTranslatedCycleDetector::addRecord(Side side, std::uint64_t step, int state, const TMTape &tape)
+{
+    //Cells "behind" the head are to its left for right records and to its right for left records:
+    const int behind = side == Right ? -1 : 1;
+    std::vector<Record> &records = m_Records[side];
+    const int newest = m_NextRecord[side];
+
+    Record &record = records[newest];
+    record.step = step;
+    record.head = tape.getHeadPosition();
+    record.state = state;
+    record.reach = side == Right ? m_RightReach : m_LeftReach;
+    for(int i = 0; i < Window; i++)
+        record.cells[i] = tape.at(record.head + behind * i);
+
+    if(side == Right)
+        m_RightReach = record.head;
+    else
+        m_LeftReach = record.head;
+    m_NextRecord[side] = (newest + 1) % History;
+    m_NumRecords[side] = std::min(m_NumRecords[side] + 1, static_cast<int>(History));
+
+    //Walk back through the earlier records, widening the part of the tape the run went back over:
+    std::int64_t reach = record.head;
+    for(int k = 1; k < m_NumRecords[side]; k++)
+    {
+        const Record &newer = records[(newest - k + 1 + History) % History];
+        const Record &older = records[(newest - k + History) % History];
+        reach = side == Right ? std::min(reach, newer.reach) : std::max(reach, newer.reach);
+
+        //How far behind the older record's head the run went before coming back:
+        std::int64_t distance = (reach - older.head) * behind;
+        if(distance >= Window)
+            break;
+        if(older.state != state)
+            continue;
+
+        if(std::equal(older.cells.begin(), older.cells.begin() + distance + 1, record.cells.begin()))
+        {
+            m_Period = step - older.step;
+            m_Offset = record.head - older.head;
+            m_CycleStart = older.step;
+            m_Found = true;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,106 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TMTRANSLATEDCYCLEDETECTOR_H
+#define TMTRANSLATEDCYCLEDETECTOR_H
+
+#include "tmtape.h"
+#include "tmtypes.h"
+#include <cstdint>
+#include <vector>
+
+/* Detects a run that repeats the same local behaviour while drifting along the tape, which never
+ * repeats a configuration exactly but never halts either.
+ *
+ * A record is taken whenever the head reaches a cell no earlier step has visited. At a record on the
+ * right everything right of the head is blank, so if an earlier right record has the same state and
+ * the same cells between the head and the furthest the head went back left in between, the run from
+ * the new record repeats the run from the earlier one shifted along the tape, forever. Left records
+ * are handled the same way mirrored.
+ *
+ * Only the last History records of each side are kept, each with the Window cells behind the head,
+ * so periods spanning more records or going back further than Window cells are not found.
+*/
+class TMTranslatedCycleDetector
+{
+public:
+    enum {Window = 64, History = 128};
+
+    //Constructor:
+    TMTranslatedCycleDetector();
+
+    //Accessor functions:
+    bool isStarted() const;
+    bool hasCycle() const;
+    std::uint64_t getPeriod() const;
+    std::int64_t getOffset() const;
+    std::uint64_t getCycleStart() const;
+
+    //Mutator functions:
+    void clear();
+    void begin(const TMTape &tape);
+
+    //Hot loop function, kept inline. Returns true once the run after the given step is a translated cycle:
+    bool check(std::uint64_t step, int state, const TMTape &tape)
+    {
+        std::int64_t head = tape.getHeadPosition();
+        if(head < m_RightReach)
+            m_RightReach = head;
+        if(head > m_LeftReach)
+            m_LeftReach = head;
+
+        if(head > m_Rightmost)
+        {
+            m_Rightmost = head;
+            return this->addRecord(Right, step, state, tape);
+        }
+        if(head < m_Leftmost)
+        {
+            m_Leftmost = head;
+            return this->addRecord(Left, step, state, tape);
+        }
+        return false;
+    }
+
+private:
+    enum Side {Right, Left};
+
+    //The configuration at a record, with the cells from the head back towards the rest of the tape:
+    struct Record
+    {
+        std::uint64_t step;
+        std::int64_t head;
+        std::int64_t reach;
+        int state;
+        std::vector<TMSymbol> cells;
+    };
+
+    bool addRecord(Side side, std::uint64_t step, int state, const TMTape &tape);
+
+    std::vector<Record> m_Records[2];
+    int m_NextRecord[2];
+    int m_NumRecords[2];
+    std::int64_t m_Rightmost;
+    std::int64_t m_Leftmost;
+    std::int64_t m_RightReach;
+    std::int64_t m_LeftReach;
+    std::uint64_t m_Period;
+    std::int64_t m_Offset;
+    std::uint64_t m_CycleStart;
+    bool m_Started;
+    bool m_Found;
+};
+
+#endif // TMTRANSLATEDCYCLEDETECTOR_H
@@ -13,22 +13,20 @@
  * If not, see <https://www.gnu.org/licenses/>.
 */
 
-#ifndef SQUARETAPECELL_H
-#define SQUARETAPECELL_H
+#ifndef TMTYPES_H
+#define TMTYPES_H
 
-#include <QGraphicsRectItem>
+#include <cstdint>
 
-class SquareTapeCell : public QGraphicsRectItem
-{
-public:
-    //Constructor:
-    explicit SquareTapeCell(QRectF rect = QRect());
-
-    //Mutator member functions:
-    void setLabel(QString label);
+//Dense symbol id used by the compiled engine. Id 0 is always the blank symbol '-':
+typedef std::uint16_t TMSymbol;
 
-private:
-    QGraphicsTextItem *m_Label;
+//Head movements encoded as small integers so they can be added to the head position:
+enum TMMove : std::int8_t
+{
+    TMMoveLeft = -1,
+    TMMoveStay = 0,
+    TMMoveRight = 1
 };
 
-#endif // SQUARETAPECELL_H
+#endif // TMTYPES_H
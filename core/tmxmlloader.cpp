@@ -0,0 +1,215 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tmxmlloader.h"
+#include "tmmultitapemachine.h"
+#include <QFile>
+#include <QStringList>
+#include <QXmlStreamReader>
+
+TMXmlLoader::TMXmlLoader()
+{
+}
+
+const TMMachineDescription &TMXmlLoader::getMachine() const
+{
+    return m_Machine;
+}
+
+QString TMXmlLoader::getDescription() const
+{
+    return m_Description;
+}
+
+QString TMXmlLoader::getErrorString() const
+{
+    return m_ErrorString;
+}
+
+bool TMXmlLoader::load(const QString &fileName)
+{
+    QFile loadFile(fileName);
+    if(!loadFile.open(QFile::ReadOnly))
+    {
+        m_ErrorString = QString("Could not open %1: %2") .arg(fileName) .arg(loadFile.errorString());
+        return false;
+    }
+    return this->read(&loadFile);
+}
+
+bool TMXmlLoader::read(QIODevice *device)
+{
+    m_Machine.clear();
+    m_Description = "";
+    m_ErrorString = "";
+
+    QXmlStreamReader reader(device);
+
+    //Data of the state being read:
+    QString name = "";
+    QString pointingTo = "";
+    QStringList labels;
+    QVector<TMTransitionDescription> edges;
+    bool isStartState = false;
+    bool isHaltState = false;
+    QString startState = "";
+    bool inEdge = false;
+    bool inLoopEdge = false;
+
+    while(!reader.atEnd())
+    {
+        reader.readNext();
+        if(reader.isStartElement())
+        {
+            if(reader.name() == QString("TuringMachine"))
+            {
+                m_Description = reader.attributes().value("Description").toString();
+
+                //Machines saved without a tape count have one tape:
+                if(reader.attributes().hasAttribute("Tapes"))
+                {
+                    int tapes = reader.attributes().value("Tapes").toInt();
+                    if(tapes < 1 || tapes > TMMultiTapeMachine::MaxTapes)
+                    {
+                        m_ErrorString = QString("Machines can have 1 to %1 tapes") .arg(int(TMMultiTapeMachine::MaxTapes));
+                        return false;
+                    }
+                    m_Machine.setNumTapes(tapes);
+                }
+            }
+            else if(reader.name() == QString("State"))
+            {
+                name = "";
+                edges.clear();
+                isStartState = false;
+                isHaltState = false;
+            }
+            else if(reader.name() == QString("Name"))
+                name = reader.readElementText();
+            else if(reader.name() == QString("StartState"))
+                isStartState = reader.readElementText() == QString("true");
+            else if(reader.name() == QString("HaltState"))
+                isHaltState = reader.readElementText() == QString("true");
+            else if(reader.name() == QString("LoopEdge"))
+            {
+                inLoopEdge = true;
+                labels.clear();
+            }
+            else if(reader.name().startsWith(QString("Edge")) && reader.name() != QString("Edges"))
+            {
+                inEdge = true;
+                labels.clear();
+                pointingTo = "";
+            }
+            else if(reader.name() == QString("Label") && (inEdge || inLoopEdge))
+                labels = reader.readElementText().split('/', Qt::SkipEmptyParts);
+            else if(reader.name() == QString("PointingTo") && inEdge)
+                pointingTo = reader.readElementText();
+        }
+        else if(reader.isEndElement())
+        {
+            //Make a transition for each label on the arrow, as MyStateItem::describe() does:
+            bool loopEnd = reader.name() == QString("LoopEdge");
+            bool edgeEnd = inEdge && reader.name().startsWith(QString("Edge")) && reader.name() != QString("Edges");
+            if(loopEnd || edgeEnd)
+            {
+                int to = TMMachineDescription::stateId(loopEnd ? name : pointingTo);
+                if(to < 0)
+                {
+                    m_ErrorString = QString("The state %1 has an edge to \"%2\", which is not a state name")
+                                        .arg(name) .arg(loopEnd ? name : pointingTo);
+                    return false;
+                }
+                for(const QString &label : labels)
+                {
+                    TMTransitionDescription edge{-1, to, QStringList(), QStringList(), QVector<TMMove>()};
+                    if(!TMMachineDescription::parseLabel(label, m_Machine.getNumTapes(), edge))
+                    {
+                        m_ErrorString = QString("The state %1 has an invalid label \"%2\"") .arg(name) .arg(label);
+                        return false;
+                    }
+                    edges.append(edge);
+                }
+                if(loopEnd)
+                    inLoopEdge = false;
+                else
+                    inEdge = false;
+            }
+            else if(reader.name() == QString("State"))
+            {
+                if(!isHaltState && edges.isEmpty())
+                {
+                    m_ErrorString = QString("The state %1 has no edges") .arg(name);
+                    return false;
+                }
+
+                //States are named q<number>; the number is the id and must be unique:
+                int id = TMMachineDescription::stateId(name);
+                if(id < 0)
+                {
+                    m_ErrorString = QString("\"%1\" is not a state name") .arg(name);
+                    return false;
+                }
+                if(m_Machine.indexOf(id) >= 0)
+                {
+                    m_ErrorString = QString("The state %1 appears more than once") .arg(name);
+                    return false;
+                }
+                if(isStartState && !startState.isEmpty())
+                {
+                    m_ErrorString = QString("The states %1 and %2 are both START states") .arg(startState) .arg(name);
+                    return false;
+                }
+                if(isStartState)
+                    startState = name;
+
+                m_Machine.addState(id, isStartState, isHaltState);
+                if(!isHaltState)
+                {
+                    for(const TMTransitionDescription &edge : edges)
+                        m_Machine.addTransition(id, edge.toState, edge.read, edge.write, edge.move);
+                }
+            }
+        }
+    }
+
+    if(reader.hasError())
+    {
+        m_ErrorString = QString("%1 on line %2") .arg(reader.errorString()) .arg(reader.lineNumber());
+        return false;
+    }
+
+    if(m_Machine.isEmpty())
+    {
+        m_ErrorString = "The file does not contain any states";
+        return false;
+    }
+
+    //Edges can point to states further down the file, so their targets are checked once every state is read:
+    for(const TMStateDescription &state : m_Machine.getStates())
+    {
+        for(const TMTransitionDescription &transition : state.transitions)
+        {
+            if(m_Machine.indexOf(transition.toState) < 0)
+            {
+                m_ErrorString = QString("The state %1 has an edge to %2, which does not exist")
+                                    .arg(TMMachineDescription::stateName(state.id))
+                                    .arg(TMMachineDescription::stateName(transition.toState));
+                return false;
+            }
+        }
+    }
+    return true;
+}
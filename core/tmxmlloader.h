@@ -13,27 +13,38 @@
  * If not, see <https://www.gnu.org/licenses/>.
 */
 
-#include <QFont>
-#include "squaretapecell.h"
-#include <QPen>
+#ifndef TMXMLLOADER_H
+#define TMXMLLOADER_H
 
-SquareTapeCell::SquareTapeCell(QRectF rect)
-    : QGraphicsRectItem(rect, nullptr)
-{
-    //Initialize label:
-    m_Label = new QGraphicsTextItem("a", this);
-   /* m_Label->setPos(this->sceneBoundingRect().center().x() - this->scenePos().x(),
-                    this->sceneBoundingRect().center().y() - this->scenePos().y());*/
-    m_Label->setPos(this->rect().x(), this->rect().y() - m_Label->sceneBoundingRect().height() / 2.5);
-    m_Label->setScale(3.0);
-    QFont font = m_Label->font();
-    font.setPointSizeF(4.0);
-    m_Label->setFont(font);
-    this->setPen(QPen(Qt::darkGray, 1.5));
-}
-
-void SquareTapeCell::setLabel(QString label)
+#include "tmmachinedescription.h"
+#include <QString>
+
+class QIODevice;
+
+/* Reads a TM saved by TuringMachineWindow::getSaveDetails() without creating any graphics items.
+ *
+ * The states are read into a TMMachineDescription, the same one MyStateItem::describe() builds
+ * from the scene, so the result can be handed straight to TuringMachine.
+*/
+class TMXmlLoader
 {
-    m_Label->setPlainText(label);
-}
+public:
+    //Constructor:
+    TMXmlLoader();
+
+    //Accessor functions:
+    const TMMachineDescription &getMachine() const;
+    QString getDescription() const;
+    QString getErrorString() const;
+
+    //Mutator functions:
+    bool load(const QString &fileName);
+    bool read(QIODevice *device);
+
+private:
+    TMMachineDescription m_Machine;
+    QString m_Description;
+    QString m_ErrorString;
+};
 
+#endif // TMXMLLOADER_H
@@ -0,0 +1,196 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "turingmachine.h"
+#include <QStringList>
+#include <QString>
+#include <QDebug>
+#include <QHash>
+
+TuringMachine::TuringMachine(const TMMachineDescription &description):
+    m_StatesBuilt(false), m_Description(description), m_NumOfStates(0)
+{
+}
+
+TMState TuringMachine::getState(int stateNum) const
+{
+    this->buildStates();
+    if(stateNum >= 0 && stateNum < m_Machine.length() && !m_Machine.isEmpty())
+        return m_Machine[stateNum];
+
+    return TMState();
+}
+
+int TuringMachine::getStateIndex(int stateNum) const
+{
+    return m_StateIndex.value(stateNum, -1);
+}
+
+const TMMachineDescription &TuringMachine::getDescription() const
+{
+    return m_Description;
+}
+
+const TMCompiledMachine &TuringMachine::getCompiledMachine() const
+{
+    return m_Compiled;
+}
+
+const TMMultiTapeMachine &TuringMachine::getMultiTapeMachine() const
+{
+    return m_MultiTape;
+}
+
+const TMSymbolTable &TuringMachine::getSymbolTable() const
+{
+    if(this->getNumTapes() > 1)
+        return m_MultiTape.getSymbolTable();
+    return m_Compiled.getSymbolTable();
+}
+
+QStringList TuringMachine::tokenize(const QString &input) const
+{
+    //Split the input into the symbols of this machine's alphabet:
+    QStringList tokens;
+    for(const std::string &token : this->getSymbolTable().tokenize(input.toStdString()))
+        tokens.append(QString::fromStdString(token));
+    return tokens;
+}
+
+int TuringMachine::getNumStates()
+{
+    return m_NumOfStates;
+}
+
+int TuringMachine::getNumTapes() const
+{
+    return m_Description.getNumTapes();
+}
+
+void TuringMachine::addState(TMState theState)
+{
+    m_Machine.append(theState);
+}
+
+QString TuringMachine::getErrorString() const
+{
+    return m_ErrorString;
+}
+
+bool TuringMachine::build()
+{
+    //Number the states in the order they were described:
+    m_StateIndex.reserve(m_Description.getNumStates());
+    for(const TMStateDescription &state : m_Description.getStates())
+        m_StateIndex.insert(state.id, m_NumOfStates++);
+
+    //Lay the machine out as a transition table for the compiled engines:
+    if(this->getNumTapes() > 1)
+        this->compileMultiTape();
+    else
+        this->compile();
+
+    //A full symbol table maps every further symbol to the blank, so the table would be wrong:
+    if(this->getSymbolTable().hasOverflowed())
+    {
+        m_ErrorString = QObject::tr("The TM uses more than %1 tape symbols.").arg(int(TMSymbolTable::MaxSymbols));
+        return false;
+    }
+    return true;
+}
+
+void TuringMachine::buildStates() const
+{
+    //Only the interpreted engine reads TMStates, so they are not made until it asks. Batch runs share one
+    //machine between threads, hence the lock. TMEdge only models the first tape:
+    if(m_StatesBuilt.load(std::memory_order_acquire))
+        return;
+    QMutexLocker locker(&m_StatesMutex);
+    if(m_StatesBuilt.load(std::memory_order_relaxed))
+        return;
+
+    m_Machine.reserve(m_Machine.length() + m_Description.getNumStates());
+    for(const TMStateDescription &state : m_Description.getStates())
+    {
+        TMState tempState(state.id, state.isStart, state.isHalt);
+        for(const TMTransitionDescription &transition : state.transitions)
+            tempState.addEdge(TMEdge(transition.fromState, transition.toState, transition.read[0], transition.write[0],
+                                     TMMachineDescription::moveName(transition.move[0])));
+        m_Machine.append(tempState);
+    }
+    m_StatesBuilt.store(true, std::memory_order_release);
+}
+
+void TuringMachine::compile()
+{
+    m_Compiled.clear();
+    m_Compiled.setNumStates(m_Description.getNumStates());
+
+    //Read the typed description rather than the TMState copies, so moves need no string compares:
+    for(int i = 0; i < m_Description.getNumStates(); i++)
+    {
+        const TMStateDescription &state = m_Description.getState(i);
+        if(state.isStart)
+            m_Compiled.setStartState(i);
+        m_Compiled.setHALTState(i, state.isHalt);
+
+        for(const TMTransitionDescription &transition : state.transitions)
+        {
+            int toState = m_StateIndex.value(transition.toState, -1);
+            if(toState < 0)
+                continue;
+
+            m_Compiled.addTransition(i, m_Compiled.addSymbol(transition.read[0].toStdString()), toState,
+                                     m_Compiled.addSymbol(transition.write[0].toStdString()), transition.move[0]);
+        }
+    }
+    m_Compiled.compile();
+}
+
+void TuringMachine::compileMultiTape()
+{
+    m_MultiTape.clear();
+    m_MultiTape.setNumTapes(this->getNumTapes());
+    m_MultiTape.setNumStates(m_Description.getNumStates());
+
+    std::vector<TMSymbol> read, write;
+    std::vector<int> move;
+    for(int i = 0; i < m_Description.getNumStates(); i++)
+    {
+        const TMStateDescription &state = m_Description.getState(i);
+        if(state.isStart)
+            m_MultiTape.setStartState(i);
+        m_MultiTape.setHALTState(i, state.isHalt);
+
+        for(const TMTransitionDescription &transition : state.transitions)
+        {
+            int toState = m_StateIndex.value(transition.toState, -1);
+            if(toState < 0)
+                continue;
+
+            read.clear();
+            write.clear();
+            move.clear();
+            for(int tape = 0; tape < transition.read.length(); tape++)
+            {
+                read.push_back(m_MultiTape.addSymbol(transition.read[tape].toStdString()));
+                write.push_back(m_MultiTape.addSymbol(transition.write[tape].toStdString()));
+                move.push_back(transition.move[tape]);
+            }
+            m_MultiTape.addTransition(i, read, toState, write, move);
+        }
+    }
+    m_MultiTape.compile();
+}
@@ -0,0 +1,69 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TURINGMACHINE_H
+#define TURINGMACHINE_H
+
+#include "tmstate.h"
+#include "tmedge.h"
+#include "tmcompiledmachine.h"
+#include "tmmultitapemachine.h"
+#include "tmmachinedescription.h"
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <atomic>
+
+class TuringMachine : public QObject
+{
+public:
+    //Constructor:
+    explicit TuringMachine(const TMMachineDescription &description);
+
+    //Accessor functions:
+    TMState getState(int stateNum) const;
+    int getStateIndex(int stateNum) const;
+    const TMMachineDescription &getDescription() const;
+    const TMCompiledMachine &getCompiledMachine() const;
+    const TMMultiTapeMachine &getMultiTapeMachine() const;
+    const TMSymbolTable &getSymbolTable() const;
+    QStringList tokenize(const QString &input) const;
+    int getNumStates();
+    int getNumTapes() const;
+    QString getErrorString() const;
+
+    //Mutator functions:
+    void addState(TMState theState);
+    bool build();
+
+private:
+    void buildStates() const;
+    void compile();
+    void compileMultiTape();
+
+    //TMState copies for the interpreted engine, made the first time getState() is called:
+    mutable QList<TMState> m_Machine;
+    mutable QMutex m_StatesMutex;
+    mutable std::atomic<bool> m_StatesBuilt;
+    TMMachineDescription m_Description;
+    QHash<int, int> m_StateIndex;
+    TMCompiledMachine m_Compiled;
+    TMMultiTapeMachine m_MultiTape;
+    int m_NumOfStates;
+    QString m_ErrorString;
+};
+
+#endif // TURINGMACHINE_H
@@ -0,0 +1,184 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "batchtestdialog.h"
+#include <QDir>
+#include <QFile>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLocale>
+#include <QVBoxLayout>
+
+BatchTestDialog::BatchTestDialog(TuringMachine *theTM, const TMRunConfig &config, TMProcessor::ExecutionMode mode,
+                                 QWidget *parent):
+    QDialog(parent)
+{
+    //Setup:
+    this->setWindowTitle("Batch Test");
+    this->resize(760, 560);
+    this->setFont(QFont("Corbel Light", 11));
+
+    m_Runner = new TMBatchRunner(this);
+    m_Runner->setMachine(theTM);
+    m_Runner->setRunConfig(config);
+    m_Runner->setExecutionMode(mode);
+    connect(m_Runner, SIGNAL(progress(int,int)), this, SLOT(showProgress(int,int)));
+    connect(m_Runner, SIGNAL(finished()), this, SLOT(runnerFinished()));
+
+    //Inputs:
+    m_InputsEdit = new QPlainTextEdit(this);
+    m_InputsEdit->setPlaceholderText("One input per line, optionally followed by a tab and the expected outcome:\n"
+                                     "ACCEPTED, CRASHED, LOOP or LIMIT. Lines starting with # are skipped.");
+    m_InputsEdit->setMaximumHeight(150);
+
+    //Buttons and progress:
+    m_LoadButton = new QPushButton("Load file...", this);
+    m_RunButton = new QPushButton("Run", this);
+    m_StopButton = new QPushButton("Stop", this);
+    m_StopButton->setEnabled(false);
+    m_ProgressBar = new QProgressBar(this);
+    m_ProgressBar->setValue(0);
+    connect(m_LoadButton, SIGNAL(clicked()), this, SLOT(loadButtonClicked()));
+    connect(m_RunButton, SIGNAL(clicked()), this, SLOT(runButtonClicked()));
+    connect(m_StopButton, SIGNAL(clicked()), this, SLOT(stopButtonClicked()));
+
+    QHBoxLayout *buttonLayout = new QHBoxLayout;
+    buttonLayout->addWidget(m_LoadButton);
+    buttonLayout->addWidget(m_RunButton);
+    buttonLayout->addWidget(m_StopButton);
+    buttonLayout->addWidget(m_ProgressBar, 1);
+
+    //Results table, sortable by any column:
+    m_ResultsModel = new QStandardItemModel(0, 7, this);
+    m_ResultsModel->setHorizontalHeaderLabels(QStringList() << "Input" << "Expected" << "Outcome" << "Result"
+                                                            << "Steps" << "Time (µs)" << "Reason");
+    m_ResultsView = new QTableView(this);
+    m_ResultsView->setModel(m_ResultsModel);
+    m_ResultsView->setSortingEnabled(true);
+    m_ResultsView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_ResultsView->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_ResultsView->verticalHeader()->hide();
+    m_ResultsView->horizontalHeader()->setStretchLastSection(true);
+
+    m_SummaryLabel = new QLabel("Enter or load inputs, then press Run.", this);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addWidget(m_InputsEdit);
+    layout->addLayout(buttonLayout);
+    layout->addWidget(m_ResultsView, 1);
+    layout->addWidget(m_SummaryLabel);
+}
+
+void BatchTestDialog::loadButtonClicked()
+{
+    QString loadPath = QDir::homePath() + "/Documents/Saved TMs";
+    QString fileName = QFileDialog::getOpenFileName(this, "Open Inputs", loadPath, "Text files (*.txt *.tsv);;All files (*)");
+    if(fileName == "")
+        return;
+
+    QFile inputFile(fileName);
+    if(inputFile.open(QFile::ReadOnly | QFile::Text))
+        m_InputsEdit->setPlainText(QString::fromUtf8(inputFile.readAll()));
+    else
+        m_SummaryLabel->setText(QString("Could not open %1: %2") .arg(fileName, inputFile.errorString()));
+}
+
+void BatchTestDialog::runButtonClicked()
+{
+    QString text = m_InputsEdit->toPlainText();
+    QTextStream stream(&text);
+    QVector<TMBatchRunner::Case> cases;
+    QString error;
+    if(!TMBatchRunner::readCases(stream, cases, error))
+    {
+        m_SummaryLabel->setText(error);
+        return;
+    }
+    if(cases.isEmpty())
+    {
+        m_SummaryLabel->setText("There are no inputs to run.");
+        return;
+    }
+
+    m_ResultsView->setSortingEnabled(false);
+    m_ResultsModel->setRowCount(0);
+    m_ProgressBar->setRange(0, cases.length());
+    m_ProgressBar->setValue(0);
+    m_SummaryLabel->setText(QString("Running %1 inputs...") .arg(cases.length()));
+    m_RunButton->setEnabled(false);
+    m_LoadButton->setEnabled(false);
+    m_StopButton->setEnabled(true);
+
+    m_Runner->setCases(cases);
+    m_Runner->startAsync();
+}
+
+void BatchTestDialog::stopButtonClicked()
+{
+    m_Runner->cancel();
+}
+
+void BatchTestDialog::showProgress(int done, int total)
+{
+    Q_UNUSED(total);
+    m_ProgressBar->setValue(done);
+}
+
+void BatchTestDialog::runnerFinished()
+{
+    m_RunButton->setEnabled(true);
+    m_LoadButton->setEnabled(true);
+    m_StopButton->setEnabled(false);
+
+    //Fill the table. Numbers are stored as display data so that they sort numerically:
+    const QVector<TMBatchRunner::Result> &results = m_Runner->getResults();
+    m_ResultsModel->setRowCount(results.length());
+    for(int i = 0; i < results.length(); i++)
+    {
+        const TMBatchRunner::Result &result = results[i];
+        QString expected = result.expected == TMBatchRunner::AnyOutcome
+                               ? QString("-") : TMBatchRunner::outcomeName(TMBatchRunner::Outcome(result.expected - 1));
+
+        QStandardItem *steps = new QStandardItem;
+        steps->setData(result.steps, Qt::DisplayRole);
+        QStandardItem *time = new QStandardItem;
+        time->setData(result.elapsedNanoseconds / 1000, Qt::DisplayRole);
+        QStandardItem *passed = new QStandardItem(result.passed ? "PASS" : "FAIL");
+        passed->setForeground(result.passed ? QColor(0, 140, 0) : QColor(200, 0, 0));
+
+        m_ResultsModel->setItem(i, 0, new QStandardItem(result.input));
+        m_ResultsModel->setItem(i, 1, new QStandardItem(expected));
+        m_ResultsModel->setItem(i, 2, new QStandardItem(TMBatchRunner::outcomeName(result.outcome)));
+        m_ResultsModel->setItem(i, 3, passed);
+        m_ResultsModel->setItem(i, 4, steps);
+        m_ResultsModel->setItem(i, 5, time);
+        m_ResultsModel->setItem(i, 6, new QStandardItem(result.reason));
+    }
+    m_ResultsView->setSortingEnabled(true);
+    m_ResultsView->resizeColumnsToContents();
+
+    QString summary = QString("%1 of %2 inputs run: %3 passed, %4 failed  |  %5 accepted, %6 crashed, %7 loops, %8 limits"
+                              "  |  %9 steps in %10 ms")
+                          .arg(results.length()) .arg(m_Runner->getCases().length())
+                          .arg(m_Runner->getNumPassed()) .arg(m_Runner->getNumFailed())
+                          .arg(m_Runner->getNumOutcomes(TMBatchRunner::Accepted))
+                          .arg(m_Runner->getNumOutcomes(TMBatchRunner::Crashed))
+                          .arg(m_Runner->getNumOutcomes(TMBatchRunner::Loop))
+                          .arg(m_Runner->getNumOutcomes(TMBatchRunner::LimitReached))
+                          .arg(QLocale().toString(m_Runner->getTotalSteps()))
+                          .arg(m_Runner->getElapsedTime());
+    m_SummaryLabel->setText(summary);
+}
@@ -0,0 +1,57 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef BATCHTESTDIALOG_H
+#define BATCHTESTDIALOG_H
+
+#include <QDialog>
+#include <QLabel>
+#include <QPlainTextEdit>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QStandardItemModel>
+#include <QTableView>
+#include "tmbatchrunner.h"
+
+//Runs a list of inputs with expected outcomes on the built TM and shows one row per input:
+class BatchTestDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    //Constructor:
+    BatchTestDialog(TuringMachine *theTM, const TMRunConfig &config, TMProcessor::ExecutionMode mode,
+                    QWidget *parent = nullptr);
+
+private slots:
+    void loadButtonClicked();
+    void runButtonClicked();
+    void stopButtonClicked();
+    void showProgress(int done, int total);
+    void runnerFinished();
+
+private:
+    TMBatchRunner *m_Runner;
+    QPlainTextEdit *m_InputsEdit;
+    QPushButton *m_LoadButton;
+    QPushButton *m_RunButton;
+    QPushButton *m_StopButton;
+    QProgressBar *m_ProgressBar;
+    QLabel *m_SummaryLabel;
+    QTableView *m_ResultsView;
+    QStandardItemModel *m_ResultsModel;
+};
+
+#endif // BATCHTESTDIALOG_H
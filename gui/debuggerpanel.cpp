@@ -0,0 +1,315 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "debuggerpanel.h"
+#include <QHBoxLayout>
+#include <QLocale>
+#include <QVBoxLayout>
+
+//Item data of the breakpoint list: the type and text the user entered, and the debugger's index or -1:
+enum {BreakpointTypeRole = Qt::UserRole, BreakpointTextRole, BreakpointIndexRole};
+
+DebuggerPanel::DebuggerPanel(QWidget *parent):
+    QWidget(parent), m_TM(nullptr), m_Processor(nullptr)
+{
+    this->setFont(QFont("Corbel Light", 11));
+
+    //Moving through the run:
+    m_FirstButton = new QPushButton("|<", this);
+    m_FirstButton->setStatusTip("Go to the first step");
+    m_RunBackButton = new QPushButton("<< Run back", this);
+    m_RunBackButton->setStatusTip("Run backwards to the previous breakpoint");
+    m_StepBackButton = new QPushButton("< Step back", this);
+    m_StepForwardButton = new QPushButton("Step >", this);
+    m_RunForwardButton = new QPushButton("Run >>", this);
+    m_RunForwardButton->setStatusTip("Run forwards to the next breakpoint");
+    m_LastButton = new QPushButton(">|", this);
+    m_LastButton->setStatusTip("Go to the last step");
+    m_StepEdit = new QLineEdit(this);
+    m_StepEdit->setPlaceholderText("Step number");
+    m_StepEdit->setMaximumWidth(140);
+    m_GoButton = new QPushButton("Go", this);
+    connect(m_FirstButton, SIGNAL(clicked()), this, SLOT(firstButtonClicked()));
+    connect(m_RunBackButton, SIGNAL(clicked()), this, SLOT(runBackButtonClicked()));
+    connect(m_StepBackButton, SIGNAL(clicked()), this, SLOT(stepBackButtonClicked()));
+    connect(m_StepForwardButton, SIGNAL(clicked()), this, SLOT(stepForwardButtonClicked()));
+    connect(m_RunForwardButton, SIGNAL(clicked()), this, SLOT(runForwardButtonClicked()));
+    connect(m_LastButton, SIGNAL(clicked()), this, SLOT(lastButtonClicked()));
+    connect(m_GoButton, SIGNAL(clicked()), this, SLOT(goButtonClicked()));
+    connect(m_StepEdit, SIGNAL(returnPressed()), this, SLOT(goButtonClicked()));
+
+    QHBoxLayout *controlLayout = new QHBoxLayout;
+    controlLayout->addWidget(m_FirstButton);
+    controlLayout->addWidget(m_RunBackButton);
+    controlLayout->addWidget(m_StepBackButton);
+    controlLayout->addWidget(m_StepForwardButton);
+    controlLayout->addWidget(m_RunForwardButton);
+    controlLayout->addWidget(m_LastButton);
+    controlLayout->addSpacing(20);
+    controlLayout->addWidget(m_StepEdit);
+    controlLayout->addWidget(m_GoButton);
+    controlLayout->addStretch(1);
+
+    //Breakpoints:
+    m_BreakpointTypeBox = new QComboBox(this);
+    m_BreakpointTypeBox->addItem("In state", TMDebugger::StateBreakpoint);
+    m_BreakpointTypeBox->addItem("Edge taken", TMDebugger::TransitionBreakpoint);
+    m_BreakpointTypeBox->addItem("Symbol written", TMDebugger::WriteBreakpoint);
+    m_BreakpointTypeBox->addItem("Head on cell", TMDebugger::HeadBreakpoint);
+    m_BreakpointEdit = new QLineEdit(this);
+    m_AddBreakpointButton = new QPushButton("Add breakpoint", this);
+    m_RemoveBreakpointButton = new QPushButton("Remove", this);
+    m_BreakpointList = new QListWidget(this);
+    m_BreakpointList->setMaximumHeight(90);
+    connect(m_BreakpointTypeBox, SIGNAL(currentIndexChanged(int)), this, SLOT(breakpointTypeChanged(int)));
+    connect(m_AddBreakpointButton, SIGNAL(clicked()), this, SLOT(addBreakpointButtonClicked()));
+    connect(m_BreakpointEdit, SIGNAL(returnPressed()), this, SLOT(addBreakpointButtonClicked()));
+    connect(m_RemoveBreakpointButton, SIGNAL(clicked()), this, SLOT(removeBreakpointButtonClicked()));
+    this->breakpointTypeChanged(0);
+
+    QHBoxLayout *breakpointLayout = new QHBoxLayout;
+    breakpointLayout->addWidget(m_BreakpointTypeBox);
+    breakpointLayout->addWidget(m_BreakpointEdit, 1);
+    breakpointLayout->addWidget(m_AddBreakpointButton);
+    breakpointLayout->addWidget(m_RemoveBreakpointButton);
+
+    m_StatusLabel = new QLabel(this);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(controlLayout);
+    layout->addWidget(m_StatusLabel);
+    layout->addLayout(breakpointLayout);
+    layout->addWidget(m_BreakpointList);
+
+    this->clearRun();
+}
+
+const TMDebugger &DebuggerPanel::getDebugger() const
+{
+    return m_Debugger;
+}
+
+bool DebuggerPanel::hasRun() const
+{
+    return m_Debugger.getTrace() != nullptr;
+}
+
+void DebuggerPanel::setRun(const TMTrace *trace, const TuringMachine *theTM, const TMProcessor *processor)
+{
+    //The breakpoints are entered as text, so they are looked up again in the new machine:
+    m_TM = theTM;
+    m_Processor = processor;
+    m_Debugger.setTrace(trace);
+    this->rebuildBreakpoints();
+    this->updateStatus();
+}
+
+void DebuggerPanel::clearRun()
+{
+    m_TM = nullptr;
+    m_Processor = nullptr;
+    m_Debugger.setTrace(nullptr);
+    this->rebuildBreakpoints();
+    this->updateStatus();
+}
+
+void DebuggerPanel::firstButtonClicked()
+{
+    m_Debugger.goToStep(0);
+    this->moved();
+}
+
+void DebuggerPanel::stepBackButtonClicked()
+{
+    m_Debugger.stepBack();
+    this->moved();
+}
+
+void DebuggerPanel::stepForwardButtonClicked()
+{
+    m_Debugger.stepForward();
+    this->moved();
+}
+
+void DebuggerPanel::lastButtonClicked()
+{
+    m_Debugger.goToStep(m_Debugger.getNumSteps());
+    this->moved();
+}
+
+void DebuggerPanel::runBackButtonClicked()
+{
+    m_Debugger.runBack();
+    this->moved();
+}
+
+void DebuggerPanel::runForwardButtonClicked()
+{
+    m_Debugger.runForward();
+    this->moved();
+}
+
+void DebuggerPanel::goButtonClicked()
+{
+    bool ok = false;
+    quint64 step = QLocale().toULongLong(m_StepEdit->text(), &ok);
+    if(!ok)
+        step = m_StepEdit->text().toULongLong(&ok);
+    if(!ok)
+    {
+        m_StatusLabel->setText(QString("\"%1\" is not a step number.") .arg(m_StepEdit->text()));
+        return;
+    }
+    m_Debugger.goToStep(step);
+    this->moved();
+}
+
+void DebuggerPanel::addBreakpointButtonClicked()
+{
+    int type = m_BreakpointTypeBox->currentData().toInt();
+    QString text = m_BreakpointEdit->text().simplified();
+    TMDebugger::Breakpoint breakpoint;
+    QString error;
+    if(this->hasRun() && !this->parseBreakpoint(type, text, breakpoint, error))
+    {
+        m_StatusLabel->setText(error);
+        return;
+    }
+
+    QListWidgetItem *item = new QListWidgetItem(QString("%1: %2") .arg(m_BreakpointTypeBox->currentText(), text));
+    item->setData(BreakpointTypeRole, type);
+    item->setData(BreakpointTextRole, text);
+    m_BreakpointList->addItem(item);
+    m_BreakpointEdit->clear();
+    this->rebuildBreakpoints();
+}
+
+void DebuggerPanel::removeBreakpointButtonClicked()
+{
+    delete m_BreakpointList->currentItem();
+    this->rebuildBreakpoints();
+}
+
+void DebuggerPanel::breakpointTypeChanged(int type)
+{
+    static const char *examples[] = {"State, for example q3", "State and symbol read, for example q3 a",
+                                     "Symbol, for example a", "Cell number, for example 12"};
+    m_BreakpointEdit->setPlaceholderText(examples[qBound(0, type, 3)]);
+}
+
+bool DebuggerPanel::parseBreakpoint(int type, const QString &text, TMDebugger::Breakpoint &breakpoint, QString &error) const
+{
+    breakpoint = TMDebugger::Breakpoint{TMDebugger::BreakpointType(type), -1, 0, 0};
+    QStringList fields = text.split(' ', Qt::SkipEmptyParts);
+    int needed = type == TMDebugger::TransitionBreakpoint ? 2 : 1;
+    if(fields.length() != needed)
+    {
+        error = needed == 2 ? "An edge breakpoint needs a state and a symbol, for example \"q3 a\"."
+                            : QString("Enter one value for the breakpoint, not \"%1\".") .arg(text);
+        return false;
+    }
+
+    //States are named as on the design tab, symbols as in the edge labels:
+    if(type == TMDebugger::StateBreakpoint || type == TMDebugger::TransitionBreakpoint)
+    {
+        breakpoint.state = m_TM->getStateIndex(TMMachineDescription::stateId(fields[0]));
+        if(breakpoint.state < 0)
+        {
+            error = QString("The TM has no state %1.") .arg(fields[0]);
+            return false;
+        }
+    }
+    if(type == TMDebugger::TransitionBreakpoint || type == TMDebugger::WriteBreakpoint)
+    {
+        int symbol = m_TM->getCompiledMachine().findSymbol(fields.last().toStdString());
+        if(symbol < 0)
+        {
+            error = QString("The TM has no symbol %1.") .arg(fields.last());
+            return false;
+        }
+        breakpoint.symbol = TMSymbol(symbol);
+    }
+    if(type == TMDebugger::HeadBreakpoint)
+    {
+        bool ok = false;
+        breakpoint.position = fields[0].toLongLong(&ok);
+        if(!ok)
+        {
+            error = QString("\"%1\" is not a cell number.") .arg(fields[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+void DebuggerPanel::rebuildBreakpoints()
+{
+    //Breakpoints that do not fit the current machine are kept in the list but greyed out:
+    m_Debugger.clearBreakpoints();
+    for(int i = 0; i < m_BreakpointList->count(); i++)
+    {
+        QListWidgetItem *item = m_BreakpointList->item(i);
+        TMDebugger::Breakpoint breakpoint;
+        QString error;
+        bool valid = this->hasRun() && this->parseBreakpoint(item->data(BreakpointTypeRole).toInt(),
+                                                             item->data(BreakpointTextRole).toString(), breakpoint, error);
+        item->setData(BreakpointIndexRole, valid ? int(m_Debugger.getBreakpoints().size()) : -1);
+        item->setForeground(valid ? this->palette().text() : this->palette().placeholderText());
+        if(valid)
+            m_Debugger.addBreakpoint(breakpoint);
+    }
+}
+
+void DebuggerPanel::moved()
+{
+    //Only moves the user makes are signalled, so a new run does not interrupt the animation:
+    this->updateStatus();
+    emit this->configurationChanged();
+}
+
+void DebuggerPanel::updateStatus()
+{
+    bool running = this->hasRun();
+    m_FirstButton->setEnabled(running && !m_Debugger.isAtStart());
+    m_RunBackButton->setEnabled(running && !m_Debugger.isAtStart());
+    m_StepBackButton->setEnabled(running && !m_Debugger.isAtStart());
+    m_StepForwardButton->setEnabled(running && !m_Debugger.isAtEnd());
+    m_RunForwardButton->setEnabled(running && !m_Debugger.isAtEnd());
+    m_LastButton->setEnabled(running && !m_Debugger.isAtEnd());
+    m_GoButton->setEnabled(running);
+
+    if(!running)
+    {
+        m_StatusLabel->setText("Test an input to step through its run. Nondeterministic runs show the accepting branch.");
+        return;
+    }
+
+    QString status = QString("Step %1 of %2  |  State %3  |  Head on cell %4 reading %5")
+                         .arg(QLocale().toString(qulonglong(m_Debugger.getStep())))
+                         .arg(QLocale().toString(qulonglong(m_Debugger.getNumSteps())))
+                         .arg(m_Processor->getStateName(m_Debugger.getState()))
+                         .arg(m_Debugger.getHeadPosition())
+                         .arg(m_Processor->getSymbolName(m_Debugger.read()));
+    int hit = m_Debugger.getHitBreakpoint();
+    for(int i = 0; i < m_BreakpointList->count() && hit != TMDebugger::NoBreakpoint; i++)
+    {
+        if(m_BreakpointList->item(i)->data(BreakpointIndexRole).toInt() == hit)
+        {
+            m_BreakpointList->setCurrentRow(i);
+            status += QString("  |  Stopped at %1") .arg(m_BreakpointList->item(i)->text());
+        }
+    }
+    m_StatusLabel->setText(status);
+}
@@ -0,0 +1,86 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef DEBUGGERPANEL_H
+#define DEBUGGERPANEL_H
+
+#include <QWidget>
+#include <QComboBox>
+#include <QLabel>
+#include <QLineEdit>
+#include <QListWidget>
+#include <QPushButton>
+#include "tmdebugger.h"
+#include "tmprocessor.h"
+
+//Steps backwards and forwards through the last test and runs to breakpoints. Lives in a dock of the main window:
+class DebuggerPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    //Constructor:
+    DebuggerPanel(QWidget *parent = nullptr);
+
+    //Accessor member functions:
+    const TMDebugger &getDebugger() const;
+    bool hasRun() const;
+
+    //Mutator member functions:
+    void setRun(const TMTrace *trace, const TuringMachine *theTM, const TMProcessor *processor);
+    void clearRun();
+
+signals:
+    //Emitted when the user moves the debugger to another configuration:
+    void configurationChanged();
+
+private slots:
+    void firstButtonClicked();
+    void stepBackButtonClicked();
+    void stepForwardButtonClicked();
+    void lastButtonClicked();
+    void runBackButtonClicked();
+    void runForwardButtonClicked();
+    void goButtonClicked();
+    void addBreakpointButtonClicked();
+    void removeBreakpointButtonClicked();
+    void breakpointTypeChanged(int type);
+
+private:
+    bool parseBreakpoint(int type, const QString &text, TMDebugger::Breakpoint &breakpoint, QString &error) const;
+    void rebuildBreakpoints();
+    void updateStatus();
+    void moved();
+
+    TMDebugger m_Debugger;
+    const TuringMachine *m_TM;
+    const TMProcessor *m_Processor;
+    QPushButton *m_FirstButton;
+    QPushButton *m_StepBackButton;
+    QPushButton *m_StepForwardButton;
+    QPushButton *m_LastButton;
+    QPushButton *m_RunBackButton;
+    QPushButton *m_RunForwardButton;
+    QLineEdit *m_StepEdit;
+    QPushButton *m_GoButton;
+    QComboBox *m_BreakpointTypeBox;
+    QLineEdit *m_BreakpointEdit;
+    QPushButton *m_AddBreakpointButton;
+    QPushButton *m_RemoveBreakpointButton;
+    QListWidget *m_BreakpointList;
+    QLabel *m_StatusLabel;
+};
+
+#endif // DEBUGGERPANEL_H
@@ -0,0 +1,191 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "executionsummaryview.h"
+#include <QApplication>
+#include <QFontDatabase>
+#include <QHBoxLayout>
+#include <QLocale>
+#include <QPainter>
+#include <QStyledItemDelegate>
+#include <QTextLayout>
+#include <QVBoxLayout>
+
+//Draws a row of the summary with the cell written by its step in bold and underlined:
+class TraceRowDelegate : public QStyledItemDelegate
+{
+public:
+    TraceRowDelegate(QObject *parent):
+        QStyledItemDelegate(parent), m_RowLength(0)
+    {
+    }
+
+    //Every row gets the same width, so the list never has to measure them all:
+    void setRowLength(int length)
+    {
+        m_RowLength = length;
+    }
+
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &) const override
+    {
+        return QSize(option.fontMetrics.horizontalAdvance(QLatin1Char('M')) * m_RowLength + 8,
+                     option.fontMetrics.height() + 4);
+    }
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override
+    {
+        //Let the style draw the background and selection, then the text on top:
+        QStyleOptionViewItem background = option;
+        this->initStyleOption(&background, index);
+        background.text = QString();
+        QStyle *style = option.widget != nullptr ? option.widget->style() : QApplication::style();
+        style->drawControl(QStyle::CE_ItemViewItem, &background, painter, option.widget);
+
+        QTextCharFormat headFormat;
+        headFormat.setFontWeight(QFont::Bold);
+        headFormat.setFontUnderline(true);
+        QTextLayout::FormatRange head;
+        head.start = index.data(TraceListModel::HeadStartRole).toInt();
+        head.length = index.data(TraceListModel::HeadLengthRole).toInt();
+        head.format = headFormat;
+
+        QTextLayout layout(index.data(Qt::DisplayRole).toString(), option.font);
+        layout.setFormats(QVector<QTextLayout::FormatRange>() << head);
+        layout.beginLayout();
+        layout.createLine();
+        layout.endLayout();
+
+        painter->save();
+        painter->setPen(option.state & QStyle::State_Selected ? option.palette.color(QPalette::HighlightedText)
+                                                                : option.palette.color(QPalette::Text));
+        layout.draw(painter, QPointF(option.rect.left() + 4, option.rect.top() + 2));
+        painter->restore();
+    }
+
+private:
+    int m_RowLength;
+};
+
+ExecutionSummaryView::ExecutionSummaryView(QWidget *parent):
+    QWidget(parent)
+{
+    //The list only asks the model for the rows in view:
+    m_Model = new TraceListModel(this);
+    m_Delegate = new TraceRowDelegate(this);
+    m_ListView = new QListView(this);
+    m_ListView->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+    m_ListView->setUniformItemSizes(true);
+    m_ListView->setItemDelegate(m_Delegate);
+    m_ListView->setModel(m_Model);
+    m_ListView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+
+    m_StepEdit = new QLineEdit(this);
+    m_StepEdit->setPlaceholderText("Step number");
+    m_StepEdit->setMaximumWidth(120);
+    m_GoButton = new QPushButton("Go", this);
+    m_SearchEdit = new QLineEdit(this);
+    m_SearchEdit->setPlaceholderText("Find a state, symbol or move");
+    m_SearchEdit->setStatusTip("Searches the transition of each step, e.g. \"q3\" or \"q3 q4 a b R\"");
+    m_FindPreviousButton = new QPushButton("Previous", this);
+    m_FindNextButton = new QPushButton("Next", this);
+    m_StatusLabel = new QLabel(this);
+    connect(m_GoButton, SIGNAL(clicked()), this, SLOT(goButtonClicked()));
+    connect(m_StepEdit, SIGNAL(returnPressed()), this, SLOT(goButtonClicked()));
+    connect(m_FindPreviousButton, SIGNAL(clicked()), this, SLOT(findPreviousButtonClicked()));
+    connect(m_FindNextButton, SIGNAL(clicked()), this, SLOT(findNextButtonClicked()));
+    connect(m_SearchEdit, SIGNAL(returnPressed()), this, SLOT(findNextButtonClicked()));
+
+    QHBoxLayout *controlLayout = new QHBoxLayout;
+    controlLayout->setContentsMargins(0, 0, 0, 0);
+    controlLayout->addWidget(m_StepEdit);
+    controlLayout->addWidget(m_GoButton);
+    controlLayout->addSpacing(20);
+    controlLayout->addWidget(m_SearchEdit, 1);
+    controlLayout->addWidget(m_FindPreviousButton);
+    controlLayout->addWidget(m_FindNextButton);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->setContentsMargins(0, 0, 0, 0);
+    layout->addWidget(m_ListView, 1);
+    layout->addLayout(controlLayout);
+    layout->addWidget(m_StatusLabel);
+
+    this->clearRun();
+}
+
+void ExecutionSummaryView::setRun(const TMTrace *trace, const TMProcessor *processor)
+{
+    m_Model->setRun(trace, processor);
+    m_Delegate->setRowLength(m_Model->getMaxRowLength());
+    m_ListView->reset();
+    m_StatusLabel->setText(QString("%1 steps") .arg(QLocale().toString(qulonglong(trace->getNumSteps()))));
+}
+
+void ExecutionSummaryView::clearRun()
+{
+    m_Model->clearRun();
+    m_StatusLabel->setText("The steps of the last test will appear here");
+}
+
+void ExecutionSummaryView::goButtonClicked()
+{
+    //Steps are numbered from 1 in the list:
+    bool ok = false;
+    qulonglong step = m_StepEdit->text().trimmed().toULongLong(&ok);
+    if(!ok || step == 0 || step > qulonglong(m_Model->rowCount()))
+    {
+        m_StatusLabel->setText(QString("Enter a step from 1 to %1") .arg(QLocale().toString(m_Model->rowCount())));
+        return;
+    }
+    this->showRow(int(step - 1));
+}
+
+void ExecutionSummaryView::findNextButtonClicked()
+{
+    this->find(true);
+}
+
+void ExecutionSummaryView::findPreviousButtonClicked()
+{
+    this->find(false);
+}
+
+void ExecutionSummaryView::find(bool forward)
+{
+    int count = m_Model->rowCount();
+    if(count == 0 || m_SearchEdit->text().trimmed().isEmpty())
+        return;
+
+    //Start next to the selected step and wrap around once:
+    QModelIndex current = m_ListView->currentIndex();
+    int from = current.isValid() ? current.row() + (forward ? 1 : -1) : (forward ? 0 : count - 1);
+    from = (from + count) % count;
+    int row = m_Model->findStep(m_SearchEdit->text(), from, forward);
+    if(row < 0)
+        row = m_Model->findStep(m_SearchEdit->text(), forward ? 0 : count - 1, forward);
+
+    if(row < 0)
+        m_StatusLabel->setText(QString("No step matches \"%1\"") .arg(m_SearchEdit->text().trimmed()));
+    else
+        this->showRow(row);
+}
+
+void ExecutionSummaryView::showRow(int row)
+{
+    QModelIndex index = m_Model->index(row);
+    m_ListView->setCurrentIndex(index);
+    m_ListView->scrollTo(index, QAbstractItemView::PositionAtCenter);
+    m_StatusLabel->setText(QString("Step %1 of %2") .arg(QLocale().toString(row + 1), QLocale().toString(m_Model->rowCount())));
+}
@@ -0,0 +1,61 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef EXECUTIONSUMMARYVIEW_H
+#define EXECUTIONSUMMARYVIEW_H
+
+#include <QWidget>
+#include <QLabel>
+#include <QLineEdit>
+#include <QListView>
+#include <QPushButton>
+#include "tracelistmodel.h"
+
+class TraceRowDelegate;
+
+//The execution summary on the summary page: every step of the last test, with a step to jump to and a search box:
+class ExecutionSummaryView : public QWidget
+{
+    Q_OBJECT
+
+public:
+    //Constructor:
+    ExecutionSummaryView(QWidget *parent = nullptr);
+
+    //Mutator member functions:
+    void setRun(const TMTrace *trace, const TMProcessor *processor);
+    void clearRun();
+
+private slots:
+    void goButtonClicked();
+    void findNextButtonClicked();
+    void findPreviousButtonClicked();
+
+private:
+    void find(bool forward);
+    void showRow(int row);
+
+    TraceListModel *m_Model;
+    TraceRowDelegate *m_Delegate;
+    QListView *m_ListView;
+    QLineEdit *m_StepEdit;
+    QPushButton *m_GoButton;
+    QLineEdit *m_SearchEdit;
+    QPushButton *m_FindPreviousButton;
+    QPushButton *m_FindNextButton;
+    QLabel *m_StatusLabel;
+};
+
+#endif // EXECUTIONSUMMARYVIEW_H
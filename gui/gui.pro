@@ -0,0 +1,82 @@
+QT       += core gui concurrent
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++17
+
+TARGET = TuringMachineSimulator
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+SOURCES += \
+    batchtestdialog.cpp \
+    colorbutton.cpp \
+    debuggerpanel.cpp \
+    executionsummaryview.cpp \
+    languagedialog.cpp \
+    looparrow.cpp \
+    main.cpp \
+    mystateitem.cpp \
+    pixmapbutton.cpp \
+    popupmessagebox.cpp \
+    profilepage.cpp \
+    profileplot.cpp \
+    qgraphicsroundedrectitem.cpp \
+    savedialog.cpp \
+    solidarrow.cpp \
+    squarebutton.cpp \
+    squarespawnbox.cpp \
+    summarytablemodel.cpp \
+    tapeanimator.cpp \
+    tapecell.cpp \
+    tapeview.cpp \
+    tmsscene.cpp \
+    tracelistmodel.cpp \
+    turingmachinewindow.cpp
+
+HEADERS += \
+    batchtestdialog.h \
+    colorbutton.h \
+    debuggerpanel.h \
+    executionsummaryview.h \
+    languagedialog.h \
+    looparrow.h \
+    mystateitem.h \
+    pixmapbutton.h \
+    popupmessagebox.h \
+    profilepage.h \
+    profileplot.h \
+    qgraphicsroundedrectitem.h \
+    savedialog.h \
+    solidarrow.h \
+    squarebutton.h \
+    squarespawnbox.h \
+    summarytablemodel.h \
+    tapeanimator.h \
+    tapecell.h \
+    tapeview.h \
+    tmsscene.h \
+    tmsview \
+    tmsview \
+    tracelistmodel.h \
+    turingmachinewindow.h
+
+include(../core/tmcore.pri)
+
+FORMS += \
+    popupmessagebox.ui \
+    savedialog.ui \
+    turingmachinewindow.ui
+
+# Application icon
+RC_FILE = TuringMachineSimulator.rc
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
+
+RESOURCES += \
+    ImagesAndIcons.qrc
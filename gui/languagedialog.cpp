@@ -0,0 +1,181 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "languagedialog.h"
+#include <QDir>
+#include <QFile>
+#include <QFileDialog>
+#include <QFormLayout>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLocale>
+#include <QTextStream>
+#include <QVBoxLayout>
+
+LanguageDialog::LanguageDialog(TuringMachine *theTM, const TMRunConfig &config, QWidget *parent):
+    QDialog(parent)
+{
+    //Setup:
+    this->setWindowTitle("Enumerate Language");
+    this->resize(640, 600);
+    this->setFont(QFont("Corbel Light", 11));
+
+    m_Enumerator = new TMLanguageEnumerator(this);
+    m_Enumerator->setMachine(theTM);
+    m_Enumerator->setRunConfig(config);
+    connect(m_Enumerator, SIGNAL(progress(quint64,quint64)), this, SLOT(showProgress(quint64,quint64)));
+    connect(m_Enumerator, SIGNAL(finished()), this, SLOT(enumeratorFinished()));
+
+    //Alphabet and length:
+    m_AlphabetEdit = new QLineEdit(TMLanguageEnumerator::inputAlphabet(*theTM).join(' '), this);
+    m_AlphabetEdit->setPlaceholderText("Input symbols separated by spaces");
+    m_MaxLengthSpinBox = new QSpinBox(this);
+    m_MaxLengthSpinBox->setRange(0, 64);
+    m_MaxLengthSpinBox->setValue(8);
+
+    QFormLayout *settingsLayout = new QFormLayout;
+    settingsLayout->addRow("Alphabet:", m_AlphabetEdit);
+    settingsLayout->addRow("Maximum length:", m_MaxLengthSpinBox);
+
+    //Buttons and progress:
+    m_RunButton = new QPushButton("Run", this);
+    m_StopButton = new QPushButton("Stop", this);
+    m_SaveButton = new QPushButton("Save accepted...", this);
+    m_StopButton->setEnabled(false);
+    m_SaveButton->setEnabled(false);
+    m_ProgressBar = new QProgressBar(this);
+    m_ProgressBar->setValue(0);
+    connect(m_RunButton, SIGNAL(clicked()), this, SLOT(runButtonClicked()));
+    connect(m_StopButton, SIGNAL(clicked()), this, SLOT(stopButtonClicked()));
+    connect(m_SaveButton, SIGNAL(clicked()), this, SLOT(saveButtonClicked()));
+
+    QHBoxLayout *buttonLayout = new QHBoxLayout;
+    buttonLayout->addWidget(m_RunButton);
+    buttonLayout->addWidget(m_StopButton);
+    buttonLayout->addWidget(m_SaveButton);
+    buttonLayout->addWidget(m_ProgressBar, 1);
+
+    //Counts by length and the accepted strings:
+    m_CountsModel = new QStandardItemModel(0, 5, this);
+    m_CountsModel->setHorizontalHeaderLabels(QStringList() << "Length" << "Strings" << "Accepted" << "Rejected" << "Undecided");
+    m_CountsView = new QTableView(this);
+    m_CountsView->setModel(m_CountsModel);
+    m_CountsView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_CountsView->verticalHeader()->hide();
+    m_CountsView->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+
+    m_AcceptedEdit = new QPlainTextEdit(this);
+    m_AcceptedEdit->setReadOnly(true);
+    m_AcceptedEdit->setPlaceholderText("Accepted strings, shortest first");
+
+    m_SummaryLabel = new QLabel("Choose a maximum length, then press Run.", this);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(settingsLayout);
+    layout->addLayout(buttonLayout);
+    layout->addWidget(m_CountsView, 1);
+    layout->addWidget(m_AcceptedEdit, 1);
+    layout->addWidget(m_SummaryLabel);
+}
+
+void LanguageDialog::runButtonClicked()
+{
+    m_Enumerator->setAlphabet(m_AlphabetEdit->text().split(' ', Qt::SkipEmptyParts));
+    m_Enumerator->setMaxLength(m_MaxLengthSpinBox->value());
+    if(!m_Enumerator->startAsync())
+    {
+        m_SummaryLabel->setText(m_Enumerator->getErrorString());
+        return;
+    }
+
+    m_CountsModel->setRowCount(0);
+    m_AcceptedEdit->clear();
+    m_ProgressBar->setRange(0, int(m_Enumerator->getNumStrings()));
+    m_ProgressBar->setValue(0);
+    m_SummaryLabel->setText(QString("Running %1 strings...") .arg(QLocale().toString(m_Enumerator->getNumStrings())));
+    m_RunButton->setEnabled(false);
+    m_SaveButton->setEnabled(false);
+    m_StopButton->setEnabled(true);
+}
+
+void LanguageDialog::stopButtonClicked()
+{
+    m_Enumerator->cancel();
+}
+
+void LanguageDialog::saveButtonClicked()
+{
+    QString savePath = QDir::homePath() + "/Documents/Saved TMs";
+    QString fileName = QFileDialog::getSaveFileName(this, "Save Accepted Strings", savePath, "Text files (*.txt)");
+    if(fileName == "")
+        return;
+
+    //All accepted strings, not just the ones shown:
+    QFile saveFile(fileName);
+    if(!saveFile.open(QFile::WriteOnly | QFile::Text))
+    {
+        m_SummaryLabel->setText(QString("Could not open %1: %2") .arg(fileName, saveFile.errorString()));
+        return;
+    }
+    QTextStream outStream(&saveFile);
+    for(int length = 0; length < m_Enumerator->getCounts().length(); length++)
+        for(const QString &string : m_Enumerator->getAcceptedStrings(length))
+            outStream << string << '\n';
+}
+
+void LanguageDialog::showProgress(quint64 done, quint64 total)
+{
+    Q_UNUSED(total);
+    m_ProgressBar->setValue(int(done));
+}
+
+void LanguageDialog::enumeratorFinished()
+{
+    m_RunButton->setEnabled(true);
+    m_StopButton->setEnabled(false);
+    m_SaveButton->setEnabled(true);
+
+    //Counts by length:
+    const QVector<TMLanguageEnumerator::LengthCounts> &counts = m_Enumerator->getCounts();
+    m_CountsModel->setRowCount(counts.length());
+    quint64 accepted = 0;
+    for(int length = 0; length < counts.length(); length++)
+    {
+        m_CountsModel->setItem(length, 0, new QStandardItem(QString::number(length)));
+        m_CountsModel->setItem(length, 1, new QStandardItem(QLocale().toString(counts[length].strings)));
+        m_CountsModel->setItem(length, 2, new QStandardItem(QLocale().toString(counts[length].accepted)));
+        m_CountsModel->setItem(length, 3, new QStandardItem(QLocale().toString(counts[length].rejected)));
+        m_CountsModel->setItem(length, 4, new QStandardItem(QLocale().toString(counts[length].undecided)));
+        accepted += counts[length].accepted;
+    }
+
+    //The accepted strings, shortest first. A large language is cut off; Save writes all of it:
+    QStringList shown;
+    for(int length = 0; length < counts.length() && shown.length() < MaxShownStrings; length++)
+        shown += m_Enumerator->getAcceptedStrings(length, MaxShownStrings - shown.length());
+    for(QString &string : shown)
+        if(string.isEmpty())
+            string = "(empty string)";
+    if(quint64(shown.length()) < accepted)
+        shown.append(QString("... and %1 more") .arg(QLocale().toString(accepted - shown.length())));
+    m_AcceptedEdit->setPlainText(shown.join('\n'));
+
+    m_SummaryLabel->setText(QString("%1%2 of %3 strings run in %4 ms: %5 accepted")
+                                .arg(m_Enumerator->wasCancelled() ? "Stopped. " : "")
+                                .arg(QLocale().toString(m_Enumerator->getNumDone()))
+                                .arg(QLocale().toString(m_Enumerator->getNumStrings()))
+                                .arg(m_Enumerator->getElapsedTime())
+                                .arg(QLocale().toString(accepted)));
+}
@@ -0,0 +1,62 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LANGUAGEDIALOG_H
+#define LANGUAGEDIALOG_H
+
+#include <QDialog>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPlainTextEdit>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QStandardItemModel>
+#include <QTableView>
+#include "tmlanguageenumerator.h"
+
+//Runs every string up to a length on the built TM and shows the accepted ones with counts by length:
+class LanguageDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    //Constructor:
+    LanguageDialog(TuringMachine *theTM, const TMRunConfig &config, QWidget *parent = nullptr);
+
+private slots:
+    void runButtonClicked();
+    void stopButtonClicked();
+    void saveButtonClicked();
+    void showProgress(quint64 done, quint64 total);
+    void enumeratorFinished();
+
+private:
+    enum {MaxShownStrings = 10000};
+
+    TMLanguageEnumerator *m_Enumerator;
+    QLineEdit *m_AlphabetEdit;
+    QSpinBox *m_MaxLengthSpinBox;
+    QPushButton *m_RunButton;
+    QPushButton *m_StopButton;
+    QPushButton *m_SaveButton;
+    QProgressBar *m_ProgressBar;
+    QTableView *m_CountsView;
+    QStandardItemModel *m_CountsModel;
+    QPlainTextEdit *m_AcceptedEdit;
+    QLabel *m_SummaryLabel;
+};
+
+#endif // LANGUAGEDIALOG_H
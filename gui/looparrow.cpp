@@ -17,7 +17,7 @@
 #include <QGraphicsScene>
 
 LoopArrow::LoopArrow(QObject *parent,MyStateItem *parentState)
-    : QObject{parent}, m_ParentState(parentState), m_StatePointed(parentState->getStateName())
+    : QObject{parent}, m_ParentState(parentState)
 {
     //Setup polygon and settings:
     QList<QPointF> points;
@@ -54,7 +54,8 @@ QString LoopArrow::getLabel()
 
 QString LoopArrow::getStatePointed()
 {
-    return m_StatePointed;
+    //A loop arrow always points at its own state, whatever it is currently called:
+    return m_ParentState->getStateName();
 }
 
 int LoopArrow::type() const
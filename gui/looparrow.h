@@ -53,7 +53,6 @@ private:
     QGraphicsTextItem *m_Label;
     QLineF m_RotationLineBefore;
     QLineF m_RotationLineAfter;
-    QString m_StatePointed;
     QList<qreal> m_LineLengths;
 };
 
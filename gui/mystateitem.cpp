@@ -25,12 +25,14 @@ MyStateItem::MyStateItem(QObject *parent, QGraphicsItem *parentItem, QString lab
     //Initialize variables:
     m_LabelString= label;
     m_LoopArrow = nullptr;
+    m_HeatRing = nullptr;
     m_IsHALTState = false;
     m_IsSTARTState = false;
     m_HasLoopArrow = false;
     m_BrushColor = Qt::white;
     m_ConnectedArrowColor = Qt::cyan;
-    m_LabelPattern = QRegularExpression("([0-9]|[A-Z]|[a-z]|$|#|-){1,1},([0-9]|[A-Z]|[a-z]|$|#|-){1,1},(r|R|l|L|s|S){1,1}$");
+    //Symbols are any run of characters other than whitespace, commas and the '/' used to join labels when saving:
+    m_LabelPattern = QRegularExpression("^[^,/\\s]+,[^,/\\s]+,(r|R|l|L|s|S)$");
 
     //Set up:
     this->setRect(10,10,50,50);
@@ -52,6 +54,11 @@ QString MyStateItem::getStateName() const
     return m_LabelString;
 }
 
+int MyStateItem::getStateNum() const
+{
+    return TMMachineDescription::stateId(m_LabelString);
+}
+
 bool MyStateItem::isSTARTState() const
 {
     return m_IsSTARTState;
@@ -88,12 +95,15 @@ MyStateItem::Status MyStateItem::readyForProcessing() const
         }
     }
 
-    //Test the Loop arrow label;
+    //Test the Loop arrow labels;
     if(m_LoopArrow != nullptr)
     {
-        reMatch = m_LabelPattern.match(m_LoopArrow->getLabel());
-        if(!reMatch.hasMatch())
-            return MyStateItem::ArrowLabelInvalid;
+        for(const QString &label : m_LoopArrow->getLabel().split('\n', Qt::SkipEmptyParts))
+        {
+            reMatch = m_LabelPattern.match(label);
+            if(!reMatch.hasMatch())
+                return MyStateItem::ArrowLabelInvalid;
+        }
     }
     return MyStateItem::Ready;
 }
@@ -240,13 +250,19 @@ void MyStateItem::detachMyArrowsFromOtherStates()
         emit m_Arrows[i]->iLeft(m_Arrows[i]);
 }
 
-void MyStateItem::decrementStateNameNum(int stateNum)
+void MyStateItem::setStateNum(int stateNum)
 {
-    if(!m_IsHALTState)
-    {
-        m_LabelString = QString("q%1") .arg(stateNum - 1);
-        m_Label->setPlainText(m_LabelString);
-    }
+    //Keep the START/HALT tag when renaming:
+    m_LabelString = TMMachineDescription::stateName(stateNum);
+    if(m_IsSTARTState)
+        m_LabelString += "\nSTART";
+    if(m_IsHALTState)
+        m_LabelString += "\nHALT";
+    m_Label->setPlainText(m_LabelString);
+
+    //Update the name in all pointing states:
+    for(int i = 0; i < m_ArrowsPointingToThis.length(); i++)
+        m_ArrowsPointingToThis[i]->setStatePointed(m_LabelString);
 }
 
 void MyStateItem::setIsSTARTState()
@@ -307,57 +323,57 @@ void MyStateItem::setConnectedArrowColor(QColor color)
         m_LoopArrow->setPen(QPen(color, 0.12));
 }
 
-QString MyStateItem::getStateData() const
+void MyStateItem::setHeat(qreal heat, const QString &description)
 {
-    QString entry = "";
-    //Indicate whether the state is a start state or not:
-    if(m_IsSTARTState)
-        entry.append("1_");
-    else
-        entry.append("0_");
+    //The profile heat map is a ring behind the state, blue for cold through to red for the busiest state:
+    if(m_HeatRing == nullptr)
+    {
+        m_HeatRing = new QGraphicsEllipseItem(this->rect().adjusted(-5, -5, 5, 5), this);
+        m_HeatRing->setFlag(QGraphicsItem::ItemStacksBehindParent);
+        m_HeatRing->setBrush(Qt::NoBrush);
+    }
+    heat = qBound(0.0, heat, 1.0);
+    m_HeatRing->setPen(QPen(QColor::fromHsvF((1.0 - heat) * 0.66, 0.9, 0.95), 4 + 6 * heat));
+    this->setToolTip(description);
+}
 
-    //Remove extra words for processing reasons:
-    QString from = m_LabelString;
-    QString to = "";
-    if(from.contains("START"))
-        from.remove("\nSTART");
-    if(from.contains("HALT"))
-        from.remove("\nHALT");
+void MyStateItem::clearHeat()
+{
+    delete m_HeatRing;
+    m_HeatRing = nullptr;
+    this->setToolTip(QString());
+}
 
-    //Indicate whether the state is a halt state or not:
+void MyStateItem::describe(TMMachineDescription &description) const
+{
+    //Add the state, then one transition for each label on its arrows:
+    int from = this->getStateNum();
+    description.addState(from, m_IsSTARTState, m_IsHALTState);
     if(m_IsHALTState)
-        entry.append(QString("1_%1") .arg(from));
-    else
-        entry.append("0_");
+        return;
+
+    TMTransitionDescription transition;
 
     //Loop arrow:
     if(m_LoopArrow != nullptr)
     {
-        //Get all possible lables separated by a foward slash:
-        QStringList allDat = m_LoopArrow->getLabel().split('\n');
-
-        //Make an entry for each label on the arrow:
-        for(int i = 0; i < allDat.length(); i++)
-            entry +=  from + ',' + from + ',' + allDat[i] + '_';
+        for(const QString &label : m_LoopArrow->getLabel().split('\n', Qt::SkipEmptyParts))
+        {
+            if(TMMachineDescription::parseLabel(label, description.getNumTapes(), transition))
+                description.addTransition(from, from, transition.read, transition.write, transition.move);
+        }
     }
 
     //Regular arrows:
     for(int i = 0; i < m_Arrows.length(); i++)
     {
-        to = m_Arrows[i]->getStatePointedto();
-        if(to.contains("HALT"))
-            to.remove("\nHALT");
-        if(to.contains("START"))
-            to.remove("\nSTART");
-
-        //Get all possible lables separated by a foward slash:
-        QStringList allDat = m_Arrows[i]->getLabel().split('\n');
-
-        //Make an entry for each label on the arrow:
-        for(int j = 0; j < allDat.length(); j++)
-            entry += from + ',' + to + ',' + allDat[j] + '_';
+        int to = TMMachineDescription::stateId(m_Arrows[i]->getStatePointedto());
+        for(const QString &label : m_Arrows[i]->getLabel().split('\n', Qt::SkipEmptyParts))
+        {
+            if(TMMachineDescription::parseLabel(label, description.getNumTapes(), transition))
+                description.addTransition(from, to, transition.read, transition.write, transition.move);
+        }
     }
-    return entry;
 }
 
 QStringList MyStateItem::getSaveData() const
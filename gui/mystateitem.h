@@ -24,6 +24,7 @@
 #include <QObject>
 #include "solidarrow.h"
 #include "looparrow.h"
+#include "tmmachinedescription.h"
 
 class SolidArrow;
 class LoopArrow;
@@ -40,7 +41,8 @@ public:
 
     //Accessor member functions:
     QString getStateName() const;
-    QString getStateData() const;
+    int getStateNum() const;
+    void describe(TMMachineDescription &description) const;
     QStringList getSaveData() const;
     QPointF getConnectionPoint(const SolidArrow *s) const;
     bool isSTARTState() const;
@@ -59,12 +61,14 @@ public:
     void deleteArrow(QGraphicsItem *arrow);
     void detachFromPointedArrows();
     void detachMyArrowsFromOtherStates();
-    void decrementStateNameNum(int stateNum);
+    void setStateNum(int stateNum);
     void setIsSTARTState();
     void setIsHALTState();
     void setConnectionPoint(const SolidArrow *s, QPointF p);
     void changeColor(QColor color);
     void setConnectedArrowColor(QColor color);
+    void setHeat(qreal heat, const QString &description);
+    void clearHeat();
 
 protected:
     void hoverEnterEvent(QGraphicsSceneHoverEvent *event);
@@ -81,6 +85,7 @@ private:
     QRegularExpression m_LabelPattern;
     LoopArrow *m_LoopArrow;
     QGraphicsTextItem *m_Label;
+    QGraphicsEllipseItem *m_HeatRing;
     QString m_LabelString;
     QPointF translatedPoint;
     QColor m_BrushColor;
@@ -0,0 +1,127 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "profilepage.h"
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLocale>
+#include <QVBoxLayout>
+
+ProfilePage::ProfilePage(QWidget *parent):
+    QWidget(parent)
+{
+    this->setFont(QFont("Corbel Light", 11));
+
+    m_SummaryLabel = new QLabel("Test an input to profile it. Nondeterministic and multi-tape runs are not profiled.", this);
+    m_SummaryLabel->setWordWrap(true);
+    m_HeatMapCheckBox = new QCheckBox("Show heat map on the design tab", this);
+    m_HeatMapCheckBox->setChecked(true);
+    connect(m_HeatMapCheckBox, SIGNAL(toggled(bool)), this, SIGNAL(heatMapToggled(bool)));
+
+    //One row per state and one per edge that was taken. Time is the run time shared out by steps:
+    m_CountsModel = new QStandardItemModel(0, 9, this);
+    m_CountsModel->setHorizontalHeaderLabels(QStringList() << "Kind" << "From" << "Read" << "Write" << "Move" << "To"
+                                                           << "Steps" << "Share (%)" << "Time (ms)");
+    m_CountsView = new QTableView(this);
+    m_CountsView->setModel(m_CountsModel);
+    m_CountsView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_CountsView->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_CountsView->setSortingEnabled(true);
+    m_CountsView->verticalHeader()->hide();
+    m_CountsView->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_CountsView->horizontalHeader()->setStretchLastSection(true);
+
+    m_Plot = new ProfilePlot(this);
+
+    QHBoxLayout *contentLayout = new QHBoxLayout;
+    contentLayout->addWidget(m_CountsView, 3);
+    contentLayout->addWidget(m_Plot, 2);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addWidget(m_SummaryLabel);
+    layout->addWidget(m_HeatMapCheckBox);
+    layout->addLayout(contentLayout, 1);
+}
+
+const TMProfile &ProfilePage::getProfile() const
+{
+    return m_Profile;
+}
+
+bool ProfilePage::isHeatMapEnabled() const
+{
+    return m_HeatMapCheckBox->isChecked();
+}
+
+void ProfilePage::setProfile(const TMProfile &profile, const TMCompiledMachine &machine, const TMProcessor *processor)
+{
+    //Keep a copy so the plot and heat map outlive the next run starting:
+    m_Profile = profile;
+    m_Plot->setProfile(&m_Profile);
+
+    quint64 steps = m_Profile.getSteps();
+    double elapsed = m_Profile.getElapsedTime();
+    m_SummaryLabel->setText(QString("%1 steps in %2 ms  |  Head moves: %3 left, %4 stay, %5 right  |  Cells %6 to %7 visited")
+                                .arg(QLocale().toString(steps)) .arg(elapsed)
+                                .arg(QLocale().toString(qulonglong(m_Profile.getMoves(-1))))
+                                .arg(QLocale().toString(qulonglong(m_Profile.getMoves(0))))
+                                .arg(QLocale().toString(qulonglong(m_Profile.getMoves(1))))
+                                .arg(m_Profile.getLowestCell()) .arg(m_Profile.getHighestCell()));
+
+    //Fill the table with sorting off, so rows are not moved while they are added:
+    m_CountsView->setSortingEnabled(false);
+    m_CountsModel->setRowCount(0);
+    auto addRow = [&](const QString &kind, int from, const QString &read, const QString &write, const QString &move,
+                      const QString &to, quint64 hits) {
+        double share = steps > 0 ? 100.0 * hits / steps : 0.0;
+        QList<QStandardItem*> row;
+        row << new QStandardItem(kind) << new QStandardItem(processor->getStateName(from)) << new QStandardItem(read)
+            << new QStandardItem(write) << new QStandardItem(move) << new QStandardItem(to);
+        QStandardItem *hitsItem = new QStandardItem;
+        hitsItem->setData(qulonglong(hits), Qt::DisplayRole);
+        QStandardItem *shareItem = new QStandardItem;
+        shareItem->setData(qRound(share * 100) / 100.0, Qt::DisplayRole);
+        QStandardItem *timeItem = new QStandardItem;
+        timeItem->setData(qRound(elapsed * share) / 100.0, Qt::DisplayRole);
+        row << hitsItem << shareItem << timeItem;
+        m_CountsModel->appendRow(row);
+    };
+
+    for(int state = 0; state < m_Profile.getNumStates(); state++)
+    {
+        addRow("State", state, "", "", "", "", m_Profile.getStateHits(state));
+        for(TMSymbol symbol = 0; symbol < m_Profile.getNumSymbols(); symbol++)
+        {
+            quint64 hits = m_Profile.getTransitionHits(state, symbol);
+            if(hits == 0)
+                continue;
+            const TMCompiledTransition &t = machine.getTransition(state, symbol);
+            addRow("Edge", state, processor->getSymbolName(symbol), processor->getSymbolName(t.write),
+                   t.move < 0 ? "L" : (t.move > 0 ? "R" : "S"), processor->getStateName(t.nextState), hits);
+        }
+    }
+
+    //Busiest first:
+    m_CountsView->setSortingEnabled(true);
+    m_CountsView->sortByColumn(6, Qt::DescendingOrder);
+}
+
+void ProfilePage::clear()
+{
+    m_Profile.clear();
+    m_Plot->setProfile(nullptr);
+    m_CountsModel->setRowCount(0);
+    m_SummaryLabel->setText("Test an input to profile it. Nondeterministic and multi-tape runs are not profiled.");
+}
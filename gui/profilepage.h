@@ -0,0 +1,56 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef PROFILEPAGE_H
+#define PROFILEPAGE_H
+
+#include <QWidget>
+#include <QCheckBox>
+#include <QLabel>
+#include <QStandardItemModel>
+#include <QTableView>
+#include "profileplot.h"
+#include "tmprocessor.h"
+
+//The Profile tab: step counts per state and per edge of the last test, head moves, tape extent and time:
+class ProfilePage : public QWidget
+{
+    Q_OBJECT
+
+public:
+    //Constructor:
+    ProfilePage(QWidget *parent = nullptr);
+
+    //Accessor member functions:
+    const TMProfile &getProfile() const;
+    bool isHeatMapEnabled() const;
+
+    //Mutator member functions:
+    void setProfile(const TMProfile &profile, const TMCompiledMachine &machine, const TMProcessor *processor);
+    void clear();
+
+signals:
+    void heatMapToggled(bool enabled);
+
+private:
+    TMProfile m_Profile;
+    QLabel *m_SummaryLabel;
+    QCheckBox *m_HeatMapCheckBox;
+    QTableView *m_CountsView;
+    QStandardItemModel *m_CountsModel;
+    ProfilePlot *m_Plot;
+};
+
+#endif // PROFILEPAGE_H
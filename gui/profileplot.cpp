@@ -0,0 +1,114 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "profileplot.h"
+#include <QPainter>
+#include <QPainterPath>
+#include <QVector>
+
+ProfilePlot::ProfilePlot(QWidget *parent):
+    QWidget(parent), m_Profile(nullptr)
+{
+    this->setMinimumSize(320, 240);
+    this->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
+}
+
+void ProfilePlot::setProfile(const TMProfile *profile)
+{
+    m_Profile = profile;
+    this->update();
+}
+
+void ProfilePlot::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.fillRect(this->rect(), QColor(61, 61, 61));
+    painter.setPen(Qt::white);
+
+    if(m_Profile == nullptr || m_Profile->isEmpty())
+    {
+        painter.drawText(this->rect(), Qt::AlignCenter, "Test an input to see its profile here.");
+        return;
+    }
+
+    //Extent over time on top, cell visits below, each under a caption:
+    QRectF area = QRectF(this->rect()).adjusted(10, 10, -10, -10);
+    qreal half = area.height() / 2.0;
+    QRectF top(area.left(), area.top() + 18, area.width(), half - 26);
+    QRectF bottom(area.left(), area.top() + half + 18, area.width(), half - 18);
+    painter.drawText(QPointF(area.left(), area.top() + 12), "Tape extent over time");
+    painter.drawText(QPointF(area.left(), area.top() + half + 12), "Head visits per cell");
+    this->drawExtent(painter, top);
+    this->drawCellVisits(painter, bottom);
+}
+
+void ProfilePlot::drawExtent(QPainter &painter, const QRectF &area)
+{
+    const std::vector<TMProfile::ExtentSample> &samples = m_Profile->getExtentSamples();
+    if(samples.empty())
+        return;
+
+    //Steps run left to right, tape cells bottom (lowest) to top (highest):
+    qreal lastStep = qMax<qreal>(1, samples.back().step);
+    qreal lowest = m_Profile->getLowestCell();
+    qreal span = qMax<qreal>(1, m_Profile->getHighestCell() - lowest);
+    auto point = [&](std::uint64_t step, std::int64_t cell) {
+        return QPointF(area.left() + area.width() * (step / lastStep),
+                       area.bottom() - area.height() * ((cell - lowest) / span));
+    };
+
+    //The band between the leftmost and rightmost visited cell:
+    QPainterPath band;
+    band.moveTo(point(samples.front().step, samples.front().rightmost));
+    for(const TMProfile::ExtentSample &sample : samples)
+        band.lineTo(point(sample.step, sample.rightmost));
+    for(auto it = samples.rbegin(); it != samples.rend(); ++it)
+        band.lineTo(point(it->step, it->leftmost));
+    band.closeSubpath();
+
+    painter.setPen(QPen(QColor(0, 170, 255), 1));
+    painter.setBrush(QColor(0, 170, 255, 90));
+    painter.drawPath(band);
+    painter.setBrush(Qt::NoBrush);
+}
+
+void ProfilePlot::drawCellVisits(QPainter &painter, const QRectF &area)
+{
+    //Bucket the visited cells into at most one bar per pixel column:
+    std::int64_t lowest = m_Profile->getLowestCell();
+    std::int64_t numCells = m_Profile->getHighestCell() - lowest + 1;
+    int numBars = static_cast<int>(qMin<std::int64_t>(numCells, qMax(1, int(area.width()))));
+    QVector<quint64> bars(numBars, 0);
+    for(std::int64_t cell = 0; cell < numCells; cell++)
+        bars[static_cast<int>(cell * numBars / numCells)] += m_Profile->getCellVisits(lowest + cell);
+
+    quint64 highest = 1;
+    for(quint64 visits : bars)
+        highest = qMax(highest, visits);
+
+    qreal barWidth = area.width() / numBars;
+    painter.setPen(Qt::NoPen);
+    for(int i = 0; i < numBars; i++)
+    {
+        qreal height = area.height() * (qreal(bars[i]) / highest);
+        qreal heat = qreal(bars[i]) / highest;
+        painter.setBrush(QColor::fromHsvF((1.0 - heat) * 0.66, 0.9, 0.95));
+        painter.drawRect(QRectF(area.left() + i * barWidth, area.bottom() - height, qMax<qreal>(1, barWidth - 1), height));
+    }
+    painter.setBrush(Qt::NoBrush);
+}
@@ -13,34 +13,33 @@
  * If not, see <https://www.gnu.org/licenses/>.
 */
 
-#ifndef TURINGMACHINE_H
-#define TURINGMACHINE_H
+#ifndef PROFILEPLOT_H
+#define PROFILEPLOT_H
 
-#include "tmstate.h"
-#include "tmedge.h"
-#include <QList>
-#include <QObject>
+#include <QWidget>
+#include <QPaintEvent>
+#include "tmprofile.h"
 
-class TuringMachine : public QObject
+//Draws the visited tape extent against the step count, and below it how often each cell was under the head:
+class ProfilePlot : public QWidget
 {
+    Q_OBJECT
+
 public:
     //Constructor:
-    explicit TuringMachine(QStringList data);
+    ProfilePlot(QWidget *parent = nullptr);
 
-    //Accessor functions:
-    TMState getState(int stateNum) const;
-    QStringList getSummaryTableData() const;
-    int getNumStates();
+    //Mutator member functions:
+    void setProfile(const TMProfile *profile);
 
-    //Mutator functions:
-    void addState(TMState theState);
-    void build();
+protected:
+    void paintEvent(QPaintEvent *event) override;
 
 private:
-    QList<TMState> m_Machine;
-    QStringList m_Data;
-    QStringList m_SummaryTableData;
-    int m_NumOfStates;
+    void drawExtent(QPainter &painter, const QRectF &area);
+    void drawCellVisits(QPainter &painter, const QRectF &area);
+
+    const TMProfile *m_Profile;
 };
 
-#endif // TURINGMACHINE_H
+#endif // PROFILEPLOT_H
@@ -0,0 +1,115 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "summarytablemodel.h"
+#include <algorithm>
+
+SummaryTableModel::SummaryTableModel(QObject *parent):
+    QAbstractTableModel(parent), m_Machine(nullptr)
+{
+    m_RowStart.assign(1, 0);
+}
+
+int SummaryTableModel::rowCount(const QModelIndex &parent) const
+{
+    if(parent.isValid())
+        return 0;
+    return m_RowStart.back();
+}
+
+int SummaryTableModel::columnCount(const QModelIndex &parent) const
+{
+    if(parent.isValid())
+        return 0;
+    return NumColumns;
+}
+
+QVariant SummaryTableModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || m_Machine == nullptr || (role != Qt::DisplayRole && role != SortRole))
+        return QVariant();
+
+    //Find the state the row belongs to:
+    int row = index.row();
+    int state = static_cast<int>(std::upper_bound(m_RowStart.begin(), m_RowStart.end(), row) - m_RowStart.begin()) - 1;
+    if(index.column() == FromColumn)
+        return role == SortRole ? QVariant(m_StateIds[state]) : QVariant(m_StateNames[state]);
+
+    //Halt states get a single row, whatever edges they have:
+    if(m_Machine->isHALTState(state))
+    {
+        static const char *halt[NumColumns] = {"", "H ", "A", "L", "T"};
+        return role == SortRole && index.column() == ToColumn ? QVariant(-1) : QVariant(QString(halt[index.column()]));
+    }
+
+    int choiceState;
+    TMSymbol read;
+    const TMCompiledTransition &transition = m_Machine->getChoice(m_Machine->getFirstChoice(state) + row - m_RowStart[state],
+                                                                  choiceState, read);
+    switch(index.column())
+    {
+    case ToColumn:
+        return role == SortRole ? QVariant(m_StateIds[transition.nextState]) : QVariant(m_StateNames[transition.nextState]);
+    case ReadColumn:
+        return QString::fromStdString(m_Machine->getSymbolName(read));
+    case WriteColumn:
+        return QString::fromStdString(m_Machine->getSymbolName(transition.write));
+    case MoveColumn:
+        return TMMachineDescription::moveName(static_cast<TMMove>(transition.move));
+    }
+    return QVariant();
+}
+
+QVariant SummaryTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if(orientation != Qt::Horizontal || role != Qt::DisplayRole)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    static const char *labels[NumColumns] = {"From", "To", "Read", "Write", "Move"};
+    if(section >= 0 && section < NumColumns)
+        return QString(labels[section]);
+    return QVariant();
+}
+
+void SummaryTableModel::setMachine(const TuringMachine *theTM)
+{
+    this->beginResetModel();
+    m_Machine = &theTM->getCompiledMachine();
+    m_StateNames.clear();
+    m_StateIds.clear();
+    m_RowStart.assign(1, 0);
+
+    //Compiled states are numbered in description order:
+    const TMMachineDescription &description = theTM->getDescription();
+    for(int i = 0; i < m_Machine->getNumStates(); i++)
+    {
+        int id = description.getState(i).id;
+        m_StateIds.push_back(id);
+        m_StateNames.append(TMMachineDescription::stateName(id));
+        int rows = m_Machine->isHALTState(i) ? 1 : m_Machine->getFirstChoice(i + 1) - m_Machine->getFirstChoice(i);
+        m_RowStart.push_back(m_RowStart.back() + rows);
+    }
+    this->endResetModel();
+}
+
+void SummaryTableModel::clear()
+{
+    this->beginResetModel();
+    m_Machine = nullptr;
+    m_StateNames.clear();
+    m_StateIds.clear();
+    m_RowStart.assign(1, 0);
+    this->endResetModel();
+}
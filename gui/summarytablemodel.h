@@ -0,0 +1,58 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SUMMARYTABLEMODEL_H
+#define SUMMARYTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QStringList>
+#include <vector>
+#include "turingmachine.h"
+
+/* The summary table: one row per transition of the built machine and one "H A L T" row per halt state.
+ *
+ * Cells are read from the compiled transition table when the view asks for them; the model itself only keeps
+ * the state names and where each state's rows start. SortRole gives state columns their number, so a
+ * QSortFilterProxyModel sorts q2 before q10.
+*/
+class SummaryTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column {FromColumn, ToColumn, ReadColumn, WriteColumn, MoveColumn, NumColumns};
+    enum {SortRole = Qt::UserRole};
+
+    //Constructor:
+    SummaryTableModel(QObject *parent = nullptr);
+
+    //Accessor member functions:
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    //Mutator member functions:
+    void setMachine(const TuringMachine *theTM);
+    void clear();
+
+private:
+    const TMCompiledMachine *m_Machine;
+    QStringList m_StateNames;
+    std::vector<int> m_StateIds;
+    std::vector<int> m_RowStart;
+};
+
+#endif // SUMMARYTABLEMODEL_H
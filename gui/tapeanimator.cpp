@@ -0,0 +1,115 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tapeanimator.h"
+
+TapeAnimator::TapeAnimator(QObject *parent):
+    QObject(parent), m_Trace(nullptr), m_StepsPerSecond(1), m_BasePlayhead(0), m_Applied(0)
+{
+    //The animation's value is not used, only its once per frame updates:
+    m_Clock = new QVariantAnimation(this);
+    m_Clock->setStartValue(0.0);
+    m_Clock->setEndValue(1.0);
+    m_Clock->setDuration(1000);
+    m_Clock->setLoopCount(-1);
+    connect(m_Clock, SIGNAL(valueChanged(QVariant)), this, SLOT(frame()));
+}
+
+bool TapeAnimator::isRunning() const
+{
+    return m_Clock->state() == QAbstractAnimation::Running;
+}
+
+quint64 TapeAnimator::getStep() const
+{
+    return m_Applied;
+}
+
+double TapeAnimator::getStepsPerSecond() const
+{
+    return m_StepsPerSecond;
+}
+
+void TapeAnimator::setStepsPerSecond(double stepsPerSecond)
+{
+    //Carry on from where the playback is now at the new speed:
+    if(this->isRunning())
+    {
+        m_BasePlayhead += m_Elapsed.nsecsElapsed() / 1e9 * m_StepsPerSecond;
+        m_Elapsed.restart();
+    }
+    m_StepsPerSecond = qMax(0.01, stepsPerSecond);
+}
+
+void TapeAnimator::start(const TMTrace *trace)
+{
+    this->stop();
+    m_Trace = trace;
+    m_BasePlayhead = 0;
+    m_Applied = 0;
+    m_Elapsed.start();
+    m_Clock->start();
+    this->frame();
+}
+
+void TapeAnimator::stop()
+{
+    m_Clock->stop();
+}
+
+void TapeAnimator::skipToEnd()
+{
+    if(this->isRunning())
+        this->advanceTo(double(m_Trace->getNumSteps()));
+}
+
+void TapeAnimator::frame()
+{
+    if(this->isRunning())
+        this->advanceTo(m_BasePlayhead + m_Elapsed.nsecsElapsed() / 1e9 * m_StepsPerSecond);
+}
+
+void TapeAnimator::advanceTo(double playhead)
+{
+    quint64 numSteps = m_Trace->getNumSteps();
+    quint64 current = playhead >= numSteps ? numSteps : quint64(playhead);
+
+    //The step under the playhead has started, so it is applied as well:
+    quint64 due = qMin(numSteps, current + 1);
+    if(due > m_Applied)
+    {
+        quint64 from = m_Applied;
+        m_Applied = due;
+        emit this->stepsApplied(from, due);
+    }
+
+    if(current >= numSteps)
+    {
+        m_Clock->stop();
+        emit this->headMoved(m_Trace->getHeadAt(numSteps), true);
+        emit this->finished();
+        return;
+    }
+
+    //Slide over the first half of the step, then rest on the new cell:
+    if(m_StepsPerSecond > MaxSmoothRate)
+    {
+        emit this->headMoved(m_Trace->getHeadAt(due), true);
+        return;
+    }
+    const TMTraceStep &step = m_Trace->getStep(current);
+    qreal fraction = qMin(1.0, (playhead - current) * 2);
+    emit this->headMoved(step.head + step.move * fraction, fraction >= 1.0);
+}
@@ -0,0 +1,80 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TAPEANIMATOR_H
+#define TAPEANIMATOR_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QVariantAnimation>
+#include "tmtrace.h"
+
+/* Plays a recorded TMTrace back in real time, driven by one frame clock.
+ *
+ * A looping QVariantAnimation ticks once per animation frame; each tick works out from the elapsed
+ * time how far the playback should be, so the speed does not depend on how often frames arrive.
+ * Step k takes up the interval [k, k + 1) of the playback: its write and state change happen at
+ * the start, the head slides to the next cell over the first half and rests for the second.
+ *
+ * Above MaxSmoothRate steps per second the head no longer slides; every frame applies all the steps
+ * that are due in one go and puts the head on its cell. skipToEnd() applies everything that is left.
+ * The animator only reports progress through its signals and leaves the drawing to its owner.
+*/
+class TapeAnimator : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum {MaxSmoothRate = 20};
+
+    //Constructor:
+    TapeAnimator(QObject *parent = nullptr);
+
+    //Accessor functions:
+    bool isRunning() const;
+    quint64 getStep() const;
+    double getStepsPerSecond() const;
+
+    //Mutator functions:
+    void setStepsPerSecond(double stepsPerSecond);
+    void start(const TMTrace *trace);
+    void stop();
+    void skipToEnd();
+
+signals:
+    //Steps from to to - 1 have just been applied; to - from may be more than one:
+    void stepsApplied(quint64 from, quint64 to);
+
+    //The head is at a fractional cell position, and resting on its cell when resting is true:
+    void headMoved(qreal position, bool resting);
+
+    //The last step has been applied:
+    void finished();
+
+private slots:
+    void frame();
+
+private:
+    void advanceTo(double playhead);
+
+    QVariantAnimation *m_Clock;
+    QElapsedTimer m_Elapsed;
+    const TMTrace *m_Trace;
+    double m_StepsPerSecond;
+    double m_BasePlayhead;
+    quint64 m_Applied;
+};
+
+#endif // TAPEANIMATOR_H
@@ -0,0 +1,200 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tapeview.h"
+#include "tmsymboltable.h"
+#include <QPainter>
+#include <QScrollBar>
+#include <limits>
+
+TapeView::TapeView(QWidget *parent):
+    QAbstractScrollArea(parent), m_Leftmost(0), m_Length(50), m_HeadPosition(0), m_HeadResting(false)
+{
+    this->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
+    this->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+    this->horizontalScrollBar()->setSingleStep(CellWidth);
+    this->setFrameShadow(QFrame::Raised);
+    this->clear();
+}
+
+qint64 TapeView::getLength() const
+{
+    return m_Length;
+}
+
+qreal TapeView::getHeadPosition() const
+{
+    return m_HeadPosition;
+}
+
+QString TapeView::getCell(qint64 position) const
+{
+    qint64 index = position - m_Leftmost;
+    if(index < 0 || index >= static_cast<qint64>(m_Cells.size()))
+        return m_Names[0];
+    return m_Names[m_Cells[static_cast<std::size_t>(index)]];
+}
+
+QSize TapeView::sizeHint() const
+{
+    return QSize(500, 80);
+}
+
+void TapeView::setLength(qint64 length)
+{
+    //The scroll bar counts pixels in an int:
+    m_Length = qBound<qint64>(1, length, std::numeric_limits<int>::max() / CellWidth - 1);
+    this->updateScrollBar();
+    this->viewport()->update();
+}
+
+void TapeView::clear()
+{
+    //Blank is always id 0, as in TMSymbolTable:
+    m_Cells.clear();
+    m_Leftmost = 0;
+    m_Names = QStringList("-");
+    m_Ids.clear();
+    m_Ids.insert("-", 0);
+    m_HeadPosition = 0;
+    m_HeadResting = false;
+    this->updateScrollBar();
+    this->horizontalScrollBar()->setValue(0);
+    this->viewport()->update();
+}
+
+void TapeView::writeCell(qint64 position, const QString &symbol)
+{
+    TMSymbol id = this->intern(symbol);
+    if(m_Cells.empty())
+        m_Leftmost = position;
+    if(position < m_Leftmost)
+    {
+        m_Cells.insert(m_Cells.begin(), static_cast<std::size_t>(m_Leftmost - position), 0);
+        m_Leftmost = position;
+    }
+    std::size_t index = static_cast<std::size_t>(position - m_Leftmost);
+    if(index >= m_Cells.size())
+        m_Cells.resize(index + 1, 0);
+    m_Cells[index] = id;
+
+    //Only repaint when the cell is on screen:
+    qint64 x = Margin + position * CellWidth - this->horizontalScrollBar()->value();
+    if(x + CellWidth >= 0 && x <= this->viewport()->width())
+        this->viewport()->update();
+}
+
+void TapeView::setCells(qint64 leftmost, const std::vector<TMSymbol> &cells, const QStringList &names)
+{
+    //Translate the caller's symbol ids once per name rather than once per cell:
+    std::vector<TMSymbol> ids(static_cast<std::size_t>(names.length()));
+    for(int i = 0; i < names.length(); i++)
+        ids[static_cast<std::size_t>(i)] = this->intern(names[i]);
+
+    m_Leftmost = leftmost;
+    m_Cells.resize(cells.size());
+    for(std::size_t i = 0; i < cells.size(); i++)
+        m_Cells[i] = cells[i] < ids.size() ? ids[cells[i]] : 0;
+    this->viewport()->update();
+}
+
+void TapeView::setHeadPosition(qreal position, bool resting)
+{
+    m_HeadPosition = position;
+    m_HeadResting = resting;
+    this->followHead();
+    this->viewport()->update();
+}
+
+void TapeView::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+
+    QPainter painter(this->viewport());
+    painter.setRenderHint(QPainter::Antialiasing);
+    int scroll = this->horizontalScrollBar()->value();
+    int width = this->viewport()->width();
+
+    //Only the cells that overlap the viewport:
+    qint64 first = qMax<qint64>(0, (scroll - Margin) / CellWidth);
+    qint64 last = qMin<qint64>(m_Length - 1, (scroll - Margin + width) / CellWidth);
+    QFont font = painter.font();
+    font.setPointSizeF(12);
+    painter.setFont(font);
+    painter.setPen(QPen(Qt::darkGray, 1.5));
+    for(qint64 position = first; position <= last; position++)
+    {
+        QRectF cell(Margin + position * CellWidth - scroll, 16, CellWidth, CellWidth);
+        painter.drawRect(cell);
+        QString label = painter.fontMetrics().elidedText(this->getCell(position), Qt::ElideRight, CellWidth - 2);
+        painter.setPen(this->palette().text().color());
+        painter.drawText(cell, Qt::AlignCenter, label);
+        painter.setPen(QPen(Qt::darkGray, 1.5));
+    }
+
+    //The head points down at its cell and turns white while it rests there:
+    qreal centre = Margin + m_HeadPosition * CellWidth + CellWidth / 2.0 - scroll;
+    QPolygonF head;
+    head << QPointF(centre - 9, 1) << QPointF(centre, 14.5) << QPointF(centre + 9, 1);
+    painter.setPen(QPen(Qt::black, 0.9));
+    painter.setBrush(m_HeadResting ? Qt::white : Qt::black);
+    painter.drawPolygon(head);
+}
+
+void TapeView::resizeEvent(QResizeEvent *event)
+{
+    QAbstractScrollArea::resizeEvent(event);
+    this->updateScrollBar();
+}
+
+TMSymbol TapeView::intern(const QString &symbol)
+{
+    auto it = m_Ids.constFind(symbol);
+    if(it != m_Ids.constEnd())
+        return it.value();
+
+    //Another id would wrap around to the blank:
+    if(m_Names.length() >= TMSymbolTable::MaxSymbols)
+        return 0;
+
+    TMSymbol id = static_cast<TMSymbol>(m_Names.length());
+    m_Names.append(symbol);
+    m_Ids.insert(symbol, id);
+    return id;
+}
+
+void TapeView::updateScrollBar()
+{
+    int content = static_cast<int>(2 * Margin + m_Length * CellWidth);
+    this->horizontalScrollBar()->setPageStep(this->viewport()->width());
+    this->horizontalScrollBar()->setRange(0, qMax(0, content - this->viewport()->width()));
+}
+
+void TapeView::followHead()
+{
+    //Scroll just enough to keep the head FollowCells cells inside the viewport, or centre it if it is out of sight:
+    QScrollBar *scrollBar = this->horizontalScrollBar();
+    int width = this->viewport()->width();
+    qreal centre = Margin + m_HeadPosition * CellWidth + CellWidth / 2.0;
+    qreal margin = qMin<qreal>(FollowCells * CellWidth, width / 3.0);
+    qreal left = scrollBar->value() + margin;
+    qreal right = scrollBar->value() + width - margin;
+    if(centre < scrollBar->value() || centre > scrollBar->value() + width)
+        scrollBar->setValue(qRound(centre - width / 2.0));
+    else if(centre < left)
+        scrollBar->setValue(qRound(centre - margin));
+    else if(centre > right)
+        scrollBar->setValue(qRound(centre + margin - width));
+}
@@ -0,0 +1,78 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TAPEVIEW_H
+#define TAPEVIEW_H
+
+#include <QAbstractScrollArea>
+#include <QHash>
+#include <QPaintEvent>
+#include <QStringList>
+#include <vector>
+#include "tmtypes.h"
+
+/* The tape on the design tab, drawn straight from an array of symbol ids.
+ *
+ * Only the cells inside the viewport are painted, in one pass, so a tape of millions of cells costs
+ * two bytes per written cell and nothing per cell that is only scrolled past. Cells that were never
+ * written are blank. Symbols are interned to ids the first time they are written, and show as blank
+ * once all 65536 ids are taken; setCells() loads a whole stretch of tape with the caller's ids and
+ * names in one go.
+ *
+ * The head can sit between cells while it slides. The view scrolls along with it, just enough to keep
+ * it a few cells from either edge, and centres it when it jumps out of sight.
+*/
+class TapeView : public QAbstractScrollArea
+{
+    Q_OBJECT
+
+public:
+    //Constructor:
+    TapeView(QWidget *parent = nullptr);
+
+    //Accessor member functions:
+    qint64 getLength() const;
+    qreal getHeadPosition() const;
+    QString getCell(qint64 position) const;
+    QSize sizeHint() const override;
+
+    //Mutator member functions:
+    void setLength(qint64 length);
+    void clear();
+    void writeCell(qint64 position, const QString &symbol);
+    void setCells(qint64 leftmost, const std::vector<TMSymbol> &cells, const QStringList &names);
+    void setHeadPosition(qreal position, bool resting);
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+
+private:
+    enum {CellWidth = 32, Margin = 5, FollowCells = 3};
+
+    TMSymbol intern(const QString &symbol);
+    void updateScrollBar();
+    void followHead();
+
+    std::vector<TMSymbol> m_Cells;
+    QStringList m_Names;
+    QHash<QString, TMSymbol> m_Ids;
+    qint64 m_Leftmost;
+    qint64 m_Length;
+    qreal m_HeadPosition;
+    bool m_HeadResting;
+};
+
+#endif // TAPEVIEW_H
@@ -0,0 +1,208 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "tracelistmodel.h"
+#include <algorithm>
+#include <climits>
+
+//Moving the tape copy further than this along the deltas is left to the trace's keyframes:
+static const std::uint64_t MaxReplay = 4096;
+
+TraceListModel::TraceListModel(QObject *parent):
+    QAbstractListModel(parent), m_Trace(nullptr), m_Processor(nullptr), m_Rows(512)
+{
+    m_Tape = TMTraceSnapshot{0, 0, 0, std::vector<TMSymbol>(), 0};
+}
+
+int TraceListModel::rowCount(const QModelIndex &parent) const
+{
+    if(parent.isValid() || m_Trace == nullptr)
+        return 0;
+    return static_cast<int>(std::min<std::uint64_t>(m_Trace->getNumSteps(), INT_MAX));
+}
+
+QVariant TraceListModel::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= this->rowCount())
+        return QVariant();
+
+    if(role == Qt::DisplayRole)
+        return this->getRow(index.row())->text;
+    else if(role == HeadStartRole)
+        return this->getRow(index.row())->headStart;
+    else if(role == HeadLengthRole)
+        return this->getRow(index.row())->headLength;
+    return QVariant();
+}
+
+int TraceListModel::findStep(const QString &text, int from, bool forward) const
+{
+    //Only the transition part of a row is searched, so no tape has to be rebuilt:
+    QString query = text.trimmed();
+    int count = this->rowCount();
+    if(query.isEmpty() || from < 0 || from >= count)
+        return -1;
+    int direction = forward ? 1 : -1;
+
+    if(query.contains(' '))
+    {
+        for(int i = from; i >= 0 && i < count; i += direction)
+            if(this->getTransitionText(m_Trace->getStep(i)).contains(query, Qt::CaseInsensitive))
+                return i;
+        return -1;
+    }
+
+    //A single word can only fall inside one field, so match the names once and compare ids per step:
+    std::vector<char> symbolMatches(m_SymbolNames.size());
+    for(int i = 0; i < m_SymbolNames.size(); i++)
+        symbolMatches[i] = m_SymbolNames[i].contains(query, Qt::CaseInsensitive);
+    std::vector<signed char> stateMatches;
+    bool moveMatches[3] = {QString("L").contains(query, Qt::CaseInsensitive), QString("S").contains(query, Qt::CaseInsensitive),
+                           QString("R").contains(query, Qt::CaseInsensitive)};
+
+    auto stateMatch = [&](int state) {
+        if(state < 0)
+            return false;
+        if(static_cast<std::size_t>(state) >= stateMatches.size())
+            stateMatches.resize(state + 1, -1);
+        if(stateMatches[state] < 0)
+            stateMatches[state] = this->getStateName(state).contains(query, Qt::CaseInsensitive);
+        return stateMatches[state] != 0;
+    };
+    auto symbolMatch = [&](TMSymbol symbol) {
+        return symbol < symbolMatches.size() && symbolMatches[symbol];
+    };
+
+    for(int i = from; i >= 0 && i < count; i += direction)
+    {
+        const TMTraceStep &step = m_Trace->getStep(i);
+        if(stateMatch(step.fromState) || stateMatch(step.toState) || symbolMatch(step.oldSymbol)
+            || symbolMatch(step.newSymbol) || moveMatches[step.move + 1])
+            return i;
+    }
+    return -1;
+}
+
+int TraceListModel::getMaxRowLength() const
+{
+    //The step number, the cells around the head with both ellipses, the separator and the transition,
+    //allowing eight characters for a state name:
+    int symbolLength = 1;
+    for(const QString &name : m_SymbolNames)
+        symbolLength = std::max(symbolLength, int(name.length()));
+    return QString::number(this->rowCount()).length() + 2 + (2 * ContextCells + 1) * symbolLength + 2 + 21
+           + 2 * 8 + 2 * symbolLength + 5;
+}
+
+bool TraceListModel::hasRun() const
+{
+    return m_Trace != nullptr && !m_Trace->isEmpty();
+}
+
+void TraceListModel::setRun(const TMTrace *trace, const TMProcessor *processor)
+{
+    this->beginResetModel();
+    m_Trace = trace;
+    m_Processor = processor;
+    m_SymbolNames = processor->getSymbolNames();
+    m_StateNames.clear();
+    m_Rows.clear();
+    m_Tape = trace->getSnapshot(0);
+    this->endResetModel();
+}
+
+void TraceListModel::clearRun()
+{
+    this->beginResetModel();
+    m_Trace = nullptr;
+    m_Processor = nullptr;
+    m_SymbolNames.clear();
+    m_StateNames.clear();
+    m_Rows.clear();
+    m_Tape = TMTraceSnapshot{0, 0, 0, std::vector<TMSymbol>(), 0};
+    this->endResetModel();
+}
+
+const TraceListModel::Row *TraceListModel::getRow(int row) const
+{
+    if(Row *cached = m_Rows.object(row))
+        return cached;
+
+    //The row shows the tape once its step has been taken:
+    const TMTraceStep &step = m_Trace->getStep(row);
+    this->moveTape(static_cast<std::uint64_t>(row) + 1);
+
+    qint64 size = static_cast<qint64>(m_Tape.cells.size());
+    qint64 head = step.head - m_Tape.leftmost;
+    qint64 first = std::max<qint64>(0, head - ContextCells);
+    qint64 last = std::min<qint64>(size, head + ContextCells + 1);
+
+    Row *result = new Row;
+    result->text = QString("%1: ") .arg(row + 1);
+    if(first > 0)
+        result->text += QChar(0x2026);
+    result->headStart = 0;
+    result->headLength = 0;
+    for(qint64 i = first; i < last; i++)
+    {
+        QString name = m_SymbolNames.value(m_Tape.cells[static_cast<std::size_t>(i)]);
+        if(i == head)
+        {
+            result->headStart = result->text.length();
+            result->headLength = name.length();
+        }
+        result->text += name;
+    }
+    if(last < size)
+        result->text += QChar(0x2026);
+    result->text += "---------------------" + this->getTransitionText(step);
+
+    m_Rows.insert(row, result);
+    return result;
+}
+
+QString TraceListModel::getTransitionText(const TMTraceStep &step) const
+{
+    return QString("%1 %2 %3 %4 %5") .arg(this->getStateName(step.fromState), this->getStateName(step.toState),
+                                          m_SymbolNames.value(step.oldSymbol), m_SymbolNames.value(step.newSymbol),
+                                          QString(step.move < 0 ? "L" : (step.move > 0 ? "R" : "S")));
+}
+
+QString TraceListModel::getStateName(int state) const
+{
+    //State names are looked up from the processor the first time they are needed:
+    while(m_StateNames.size() <= state)
+        m_StateNames.append(QString());
+    if(m_StateNames[state].isEmpty())
+        m_StateNames[state] = m_Processor->getStateName(state);
+    return m_StateNames[state];
+}
+
+void TraceListModel::moveTape(std::uint64_t step) const
+{
+    //Nearby steps walk the deltas, undoing their writes to go back; anything further starts from a keyframe:
+    if(step >= m_Tape.step && step - m_Tape.step <= MaxReplay)
+    {
+        while(m_Tape.step < step)
+            m_Tape.applyStep(m_Trace->getStep(m_Tape.step));
+    }
+    else if(step < m_Tape.step && m_Tape.step - step <= MaxReplay)
+    {
+        while(m_Tape.step > step)
+            m_Tape.undoStep(m_Trace->getStep(m_Tape.step - 1));
+    }
+    else
+        m_Tape = m_Trace->getSnapshot(step);
+}
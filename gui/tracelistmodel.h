@@ -0,0 +1,78 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef TRACELISTMODEL_H
+#define TRACELISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QCache>
+#include <QStringList>
+#include <vector>
+#include "tmprocessor.h"
+#include "tmtrace.h"
+
+/* One row per step of the last test: the tape after the step, with the cell it wrote, and the transition taken.
+ *
+ * Rows are only formatted when a view asks for them, from a copy of the tape that is moved along the trace's
+ * deltas (or rebuilt from its nearest keyframe for a long jump), and the last few are cached. Nothing is stored
+ * per step, so memory does not grow with the length of the run.
+*/
+class TraceListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    //Item data besides the display text: where the written cell starts in it and how long it is:
+    enum {HeadStartRole = Qt::UserRole, HeadLengthRole};
+
+    //Cells shown either side of the head; longer tapes are cut off with an ellipsis:
+    enum {ContextCells = 40};
+
+    //Constructor:
+    TraceListModel(QObject *parent = nullptr);
+
+    //Accessor member functions:
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    int findStep(const QString &text, int from, bool forward) const;
+    int getMaxRowLength() const;
+    bool hasRun() const;
+
+    //Mutator member functions:
+    void setRun(const TMTrace *trace, const TMProcessor *processor);
+    void clearRun();
+
+private:
+    struct Row
+    {
+        QString text;
+        int headStart;
+        int headLength;
+    };
+
+    const Row *getRow(int row) const;
+    QString getTransitionText(const TMTraceStep &step) const;
+    QString getStateName(int state) const;
+    void moveTape(std::uint64_t step) const;
+
+    const TMTrace *m_Trace;
+    const TMProcessor *m_Processor;
+    QStringList m_SymbolNames;
+    mutable QStringList m_StateNames;
+    mutable TMTraceSnapshot m_Tape;
+    mutable QCache<int, Row> m_Rows;
+};
+
+#endif // TRACELISTMODEL_H
@@ -28,9 +28,22 @@
 #include <QDesktopServices>
 #include <QVBoxLayout>
 #include <QListWidgetItem>
+#include <QLocale>
+#include <QDockWidget>
+#include <QHeaderView>
+#include <QtMath>
 #include "popupmessagebox.h"
 #include "pixmapbutton.h"
 #include "savedialog.h"
+#include "batchtestdialog.h"
+#include "languagedialog.h"
+
+//Steps per second for a play speed setting: about one step a second at 1, and four times faster for each
+//setting above that, so that 10 plays over 300000 steps a second:
+static double playbackRate(qreal speed)
+{
+    return 1.25 * qPow(4.0, speed - 1);
+}
 
 TuringMachineWindow::TuringMachineWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -42,6 +55,7 @@ TuringMachineWindow::TuringMachineWindow(QWidget *parent)
     this->loadSettings();
     ui->tapeLengthSpinBox->setValue(m_TapeLength);
     ui->playSpeedSpinBox->setValue(m_Speed);
+    ui->maxStepsSpinBox->setValue(m_MaxSteps);
 
     //Window configurations:
     this->setWindowIcon(QIcon(":/new/prefix1/Images and Icons/sim3.png"));
@@ -51,10 +65,15 @@ TuringMachineWindow::TuringMachineWindow(QWidget *parent)
     ui->actionLoadTM->setIcon(QIcon(":/new/prefix1/Images and Icons/load icon.png"));
     ui->actionSaveTM->setFont(QFont("Corbel Light", 11));
     ui->actionSaveTM->setIcon(QIcon(":/new/prefix1/Images and Icons/save icon.png"));
+    ui->actionBatchTest->setFont(QFont("Corbel Light", 11));
+    ui->actionEnumerateLanguage->setFont(QFont("Corbel Light", 11));
+    ui->actionDebugger->setFont(QFont("Corbel Light", 11));
     ui->actionExit->setFont(QFont("Corbel Light", 11));
     ui->actionExit->setIcon(QIcon(":/new/prefix1/Images and Icons/exit icon.png"));
     ui->label->setFont(QFont("Corbel Light", 12));
     ui->clearPushButton->setFont(QFont("Corbel Light", 11));
+    ui->pauseRunButton->setFont(QFont("Corbel Light", 11));
+    ui->stopRunButton->setFont(QFont("Corbel Light", 11));
 
     //Tab icons and font size:
     ui->tabWidget->setTabIcon(0, QIcon(":/new/prefix1/Images and Icons/design icon.png"));
@@ -71,11 +90,13 @@ TuringMachineWindow::TuringMachineWindow(QWidget *parent)
     m_FileLoaded = false;
     m_TMModel = nullptr;
     m_Processor = new TMProcessor(this);
+    connect(m_Processor, SIGNAL(finished(int)), this, SLOT(processingFinished(int)));
+    connect(m_Processor, SIGNAL(progress(quint64,double,qint64,qint64)), this, SLOT(showRunProgress(quint64,double,qint64,qint64)));
+    m_Processor->setProfilingEnabled(true);
     if(m_SavePath == "")
         m_SavePath = QDir::homePath() + "/Documents/Saved TMs";
     m_LoadedFile = "";
     m_LoadedDescription = "";
-    m_CellWidth = 32;
 
     //Setup the TM scene:
     m_Scene = new TMSScene(this);
@@ -114,47 +135,19 @@ TuringMachineWindow::TuringMachineWindow(QWidget *parent)
     boxLabel->setPos(0, m_SpawnBox->sceneBoundingRect().height());
     boxLabel->setOpacity(0.8);
 
-    //Setup the tape scene:
-    m_TapeScene = new QGraphicsScene(this);
+    //Set up tape view. It draws the visible cells of the tape and follows the head:
+    ui->tapeView->setMinimumWidth(500);
+    ui->tapeView->setMaximumHeight(80);
+    ui->tapeView->setLength(m_TapeLength);
 
-    //Set up tape view:
-    ui->tapeGraphicsView->setMinimumWidth(500);
-    ui->tapeGraphicsView->setMaximumHeight(80);
-    ui->tapeGraphicsView->setAlignment(Qt::AlignVCenter | Qt::AlignLeft);
-    ui->tapeGraphicsView->setRenderHint(QPainter::Antialiasing);
-    ui->tapeGraphicsView->setScene(m_TapeScene);
-    ui->tapeGraphicsView->horizontalScrollBar()->setValue(ui->tapeGraphicsView->horizontalScrollBar()->minimum());
-
-    //Set up the tape:
-    qreal offset = 0;
-    for(int i = 0; i < m_TapeLength; i++)
-    {
-        SquareTapeCell *temp = new SquareTapeCell(QRectF(5 + offset, 16, m_CellWidth, m_CellWidth));
-        m_Tape.append(temp);
-        temp->setLabel("-");
-        m_TapeScene->addItem(temp);
-        offset += m_CellWidth;
-    }
-
-    //Set up tape head:
-    m_TapeHead = new TapeHead(this);
-    m_TapeScene->addItem(m_TapeHead);
-    m_TapeHeadStartXPos = 5 + (m_CellWidth / 2.0) - m_TapeHead->sceneBoundingRect().width()/2.0;
-    m_TapeHead->setPos(m_TapeHeadStartXPos, 1);
-
-    //Set up timers:
-    m_MoveLeftTimer = new QTimer(this);
-    m_MoveLeftTimer->setInterval(10);
-    connect(m_MoveLeftTimer, SIGNAL(timeout()), this, SLOT(moveLeft()));
-
-    m_MoveRightTimer = new QTimer(this);
-    m_MoveRightTimer->setInterval(10);
-    connect(m_MoveRightTimer, SIGNAL(timeout()), this, SLOT(moveRight()));
-
-    m_PauseTimer = new QTimer(this);
-    m_PauseTimer->setInterval(500);
-    connect(m_PauseTimer, SIGNAL(timeout()), this, SLOT(unpause()));
-    connect(this, SIGNAL(doneMoving()), this, SLOT(play()));
+    //Set up the animation, which plays the trace of a test against the frame clock:
+    m_Animator = new TapeAnimator(this);
+    m_Animator->setStepsPerSecond(playbackRate(m_Speed));
+    connect(m_Animator, SIGNAL(stepsApplied(quint64,quint64)), this, SLOT(applyAnimationSteps(quint64,quint64)));
+    connect(m_Animator, SIGNAL(headMoved(qreal,bool)), this, SLOT(moveAnimatedHead(qreal,bool)));
+    connect(m_Animator, SIGNAL(finished()), this, SLOT(animationFinished()));
+    ui->skipAnimationButton->setFont(QFont("Corbel Light", 11));
+    ui->skipAnimationButton->setEnabled(false);
 
     //Summary page:
     this->setupSummaryPage();
@@ -170,6 +163,12 @@ TuringMachineWindow::TuringMachineWindow(QWidget *parent)
     //Help page:
     this->setupHelpPage();
 
+    //Profile page:
+    this->setupProfilePage();
+
+    //Debugger dock:
+    this->setupDebugger();
+
     //Create save file if there isn't one
     QDir tempDir(QDir::homePath() + "/Documents");
     tempDir.mkdir("Saved TMs");
@@ -199,6 +198,7 @@ TuringMachineWindow::~TuringMachineWindow()
             outStream << m_TapeLength << '\n';
             outStream << m_AHCColor.name() << '\n';
             outStream << m_CSCColor.name() << '\n';
+            outStream << m_MaxSteps << '\n';
             saveFile.close();
         }
     }
@@ -208,16 +208,8 @@ TuringMachineWindow::~TuringMachineWindow()
 
 void TuringMachineWindow::clearTapeView()
 {
-    //Move the tape head back to the start:
-    m_TapeHead->setPos(m_TapeHeadStartXPos, 1);
-
-    //Replace all letter in the tape with blanks:
-    for(int i = 0; i < m_TapeLength; i++)
-        m_Tape[i]->setLabel("-");
-
-    ui->tapeGraphicsView->horizontalScrollBar()->setValue(ui->tapeGraphicsView->horizontalScrollBar()->minimum());
-    m_TapeScene->update();
-    ui->tapeGraphicsView->update();
+    //Blank the tape and move the tape head back to the start:
+    ui->tapeView->clear();
 }
 
 void TuringMachineWindow::setupSummaryPage()
@@ -227,18 +219,26 @@ void TuringMachineWindow::setupSummaryPage()
     ui->summaryTable->setFont(QFont("Corbel", 11));
     ui->summaryTable->setSizePolicy(QSizePolicy::MinimumExpanding, QSizePolicy::MinimumExpanding);
 
-    m_TableModel = new QStandardItemModel(this);
-
-    //Create the table labels:
-    QStringList headerLabels;
-    headerLabels.append("From");
-    headerLabels.append("To");
-    headerLabels.append("Read");
-    headerLabels.append("Write");
-    headerLabels.append("Move");
-    m_TableModel->setHorizontalHeaderLabels(headerLabels);
-    ui->summaryTable->setModel(m_TableModel);
-
+    //The model reads the built machine's table; the proxy sorts and filters it:
+    m_TableModel = new SummaryTableModel(this);
+    m_TableProxy = new QSortFilterProxyModel(this);
+    m_TableProxy->setSourceModel(m_TableModel);
+    m_TableProxy->setSortRole(SummaryTableModel::SortRole);
+    m_TableProxy->setFilterCaseSensitivity(Qt::CaseInsensitive);
+    ui->summaryTable->setModel(m_TableProxy);
+    ui->summaryTable->setSortingEnabled(true);
+    ui->summaryTable->sortByColumn(SummaryTableModel::FromColumn, Qt::AscendingOrder);
+
+    //Every row is the same height, so the view never measures them:
+    ui->summaryTable->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    ui->summaryTable->verticalHeader()->setDefaultSectionSize(35);
+
+    //Filter by one column at a time:
+    ui->summaryFilterColumnBox->addItem("From", SummaryTableModel::FromColumn);
+    ui->summaryFilterColumnBox->addItem("Read", SummaryTableModel::ReadColumn);
+    ui->summaryFilterColumnBox->addItem("To", SummaryTableModel::ToColumn);
+    connect(ui->summaryFilterColumnBox, SIGNAL(currentIndexChanged(int)), this, SLOT(filterSummaryTable()));
+    connect(ui->summaryFilterLineEdit, SIGNAL(textChanged(QString)), this, SLOT(filterSummaryTable()));
 }
 
 void TuringMachineWindow::setupOptionsPage()
@@ -248,6 +248,7 @@ void TuringMachineWindow::setupOptionsPage()
     connect(ui->browseButton, SIGNAL(clicked()), this, SLOT(getSaveFileLocation()));
     connect(ui->playSpeedSpinBox, SIGNAL(valueChanged(int)), this, SLOT(speedSpinBoxValueChanged(int)));
     connect(ui->tapeLengthSpinBox, SIGNAL(valueChanged(int)), this, SLOT(tapeLengthSpinBoxValueChanged(int)));
+    connect(ui->maxStepsSpinBox, SIGNAL(valueChanged(int)), this, SLOT(maxStepsSpinBoxValueChanged(int)));
     connect(ui->AHCButton, SIGNAL(clicked()), this, SLOT(changeAHCColor()));
     connect(ui->CSCButton, SIGNAL(clicked()), this, SLOT(changeCSCColor()));
 
@@ -292,23 +293,36 @@ void TuringMachineWindow::setupHelpPage()
     ui->license2TextEdit->setPlainText(licenseMessage2);
 }
 
-void TuringMachineWindow::populateSummaryTable(QStringList tableData)
+void TuringMachineWindow::setupProfilePage()
 {
-    m_TableModel->setRowCount(0);
+    //Built in code and placed after the Summary tab:
+    m_ProfilePage = new ProfilePage(this);
+    ui->tabWidget->insertTab(2, m_ProfilePage, QIcon(":/new/prefix1/Images and Icons/summary icon.png"), "Profile");
+    connect(m_ProfilePage, SIGNAL(heatMapToggled(bool)), this, SLOT(showHeatMap(bool)));
+}
 
-    //Add data to the model:
-    QList<QStandardItem*> row;
-    for(int i = 0; i < tableData.length(); i++)
-    {
-        row.clear();
-        row.append(new QStandardItem(QString("%1%2") .arg(tableData[i][0]) .arg(tableData[i][1])));
-        row.append(new QStandardItem(QString("%1%2") .arg(tableData[i][3]) .arg(tableData[i][4])));
-        row.append(new QStandardItem(tableData[i][6]));
-        row.append(new QStandardItem(tableData[i][8]));
-        row.append(new QStandardItem(tableData[i][10]));
-        m_TableModel->appendRow(row);
-        ui->summaryTable->setRowHeight(i, 35);
-    }
+void TuringMachineWindow::setupDebugger()
+{
+    //Docked under the tape, and hidden until File > Debugger opens it:
+    m_DebuggerDock = new QDockWidget("Debugger", this);
+    m_DebuggerDock->setFeatures(QDockWidget::DockWidgetClosable | QDockWidget::DockWidgetFloatable | QDockWidget::DockWidgetMovable);
+    m_DebuggerPanel = new DebuggerPanel(m_DebuggerDock);
+    m_DebuggerDock->setWidget(m_DebuggerPanel);
+    this->addDockWidget(Qt::BottomDockWidgetArea, m_DebuggerDock);
+    m_DebuggerDock->hide();
+    connect(m_DebuggerPanel, SIGNAL(configurationChanged()), this, SLOT(showDebuggerConfiguration()));
+}
+
+void TuringMachineWindow::populateSummaryTable(const TuringMachine *theTM)
+{
+    //A row for every transition, and a "H A L T" row for halt states:
+    m_TableModel->setMachine(theTM);
+}
+
+void TuringMachineWindow::filterSummaryTable()
+{
+    m_TableProxy->setFilterKeyColumn(ui->summaryFilterColumnBox->currentData().toInt());
+    m_TableProxy->setFilterFixedString(ui->summaryFilterLineEdit->text().trimmed());
 }
 
 void TuringMachineWindow::displayTestSummary()
@@ -348,51 +362,32 @@ void TuringMachineWindow::displayTestSummary()
                                           );
     }
 
-    //Retrieve and display the tape and transition records:
-    QStringList transitionRecord = m_Processor->getTransitionRecord().split('\n', Qt::SkipEmptyParts);
-    QStringList tapeRecord = m_Processor->getTapeRecord();
-
-    if(!transitionRecord.isEmpty() && !tapeRecord.isEmpty())
-    {
-        //Declare variables:
-        QStringList recordDetail;
-        QStringList transitionEntry;
-        QFont inpTextFont;
-        int index = 0;
-
-        //Set up the font:
-        inpTextFont.setFamily("Corbel");
-        inpTextFont.setLetterSpacing(QFont::AbsoluteSpacing, 5);
+    //The list formats each step from the trace as it scrolls into view:
+    ui->executionSummary->setRun(&m_Processor->getTrace(), m_Processor);
+}
 
-        QString summaryText = "";
-        QString transitionText = "";
+void TuringMachineWindow::displayProfile()
+{
+    //Only compiled runs are profiled, so other runs leave the page empty:
+    const TMProfile &profile = m_Processor->getProfile();
+    if(profile.isEmpty() || m_TMModel == nullptr)
+        m_ProfilePage->clear();
+    else
+        m_ProfilePage->setProfile(profile, m_TMModel->getCompiledMachine(), m_Processor);
+    this->showHeatMap(m_ProfilePage->isHeatMapEnabled());
+}
 
-        //Display all test result data:
-        for(int i = 0; i< tapeRecord.length(); i++)
-        {
-            if(i < tapeRecord.length() - 1)
-            {
-                // Add Tape data to the transition text
-                recordDetail = tapeRecord[i].split('-', Qt::SkipEmptyParts);
-                index = recordDetail[1].toInt();
-
-                //Add Transition data to the transition text
-                transitionEntry = transitionRecord[i].split(',', Qt::SkipEmptyParts);
-                transitionText += transitionEntry[0] + " ";
-                transitionText += transitionEntry[1] + " ";
-                transitionText += transitionEntry[2] + " ";
-                transitionText += transitionEntry[3] + " ";
-                transitionText += transitionEntry[4];
-
-                // HTML tags to highlight the character on the tape in focus
-                recordDetail[0].insert(index, "<b><u>");
-                recordDetail[0].insert(index + 7, "</u></b>");
-                summaryText += "<p>" + recordDetail[0] + "---------------------" + transitionText + "</p>";
-                transitionText = "";
-           }
-        }
-        this->ui->textEdit->setHtml(summaryText);
-    }
+void TuringMachineWindow::stopAnimation()
+{
+    m_Animator->stop();
+    ui->tapeView->setHeadPosition(ui->tapeView->getHeadPosition(), false);
+    ui->skipAnimationButton->setEnabled(false);
+
+    // Re-enable everything that the animation disabled
+    ui->clearPushButton->setEnabled(true);
+    ui->inputLineEdit->setReadOnly(false);
+    ui->tapeLengthSpinBox->setReadOnly(false);
+    ui->maxStepsSpinBox->setReadOnly(false);
 }
 
 void TuringMachineWindow::loadSettings()
@@ -408,6 +403,12 @@ void TuringMachineWindow::loadSettings()
         m_Speed = 1;
         m_AHCColor = QColor(inStream.readLine());
         m_CSCColor = QColor(inStream.readLine());
+
+        //Older settings files have no step limit:
+        bool ok = false;
+        m_MaxSteps = inStream.readLine().toInt(&ok);
+        if(!ok || m_MaxSteps < 1)
+            m_MaxSteps = 100;
         loadFile.close();
     }
     else
@@ -419,6 +420,7 @@ void TuringMachineWindow::loadSettings()
         m_Speed = 1;
         m_AHCColor = QColor("#55aa00");
         m_CSCColor = QColor("#55ffff");
+        m_MaxSteps = 100;
     }
 }
 
@@ -484,7 +486,6 @@ void TuringMachineWindow::addStateButtonClicked()
 void TuringMachineWindow::deleteStateButtonClicked()
 {
     QList<QGraphicsItem *> list = m_Scene->selectedItems();
-    QString stateNum = "";
     if(!list.isEmpty())
     {
         //Find the first state pointed to and mark it for deletion:
@@ -501,10 +502,7 @@ void TuringMachineWindow::deleteStateButtonClicked()
         {
             if(m_TM[i] == toBeDeleted)
             {
-                if(i > 9)
-                    stateNum = QString("%1%2") .arg(m_TM[i]->getStateName()[1]) .arg(m_TM[i]->getStateName()[2]);
-                else
-                    stateNum = m_TM[i]->getStateName()[1];
+                int stateNum = m_TM[i]->getStateNum();
 
                 //Detatch from arrows pointing at this state:
                 m_TM[i]->detachFromPointedArrows();
@@ -519,9 +517,12 @@ void TuringMachineWindow::deleteStateButtonClicked()
                 if(m_TM[i]->isHALTState())
                     m_HasHALTState = false;
 
-                //Rename the states:
-                for(int i = stateNum.toInt(); i < m_TM.length(); i++)
-                    m_TM[i]->decrementStateNameNum(i);
+                //Rename the states numbered after it:
+                for(MyStateItem *state : m_TM)
+                {
+                    if(state->getStateNum() > stateNum)
+                        state->setStateNum(state->getStateNum() - 1);
+                }
 
                 //Delete the state:
                 delete m_TM[i];
@@ -655,7 +656,8 @@ void TuringMachineWindow::buildButtonClicked()
             {
                 message = QString("The state %1 is not ready for processing."
                                   "\n\nOne or more of the arrows has an invalid label. Please make sure the labels are of the form:\n\n"
-                                  "(Read Letter),(Write Letter), (Move direction letter)\n\nIf there is more than one label on an arrow,"
+                                  "(Read Symbol),(Write Symbol), (Move direction letter)\n\nSymbols may be several characters long but cannot "
+                                  "contain spaces, commas or '/'. If there is more than one label on an arrow,"
                                   "please enter these on separate lines.")
                               .arg(m_TM[badStateIndex]->getStateName());
             }
@@ -664,22 +666,30 @@ void TuringMachineWindow::buildButtonClicked()
         }
         else//If all states are ready:
         {
-            QStringList statesData;
-            QString entry = "";
-            for(int i = 0; i < m_TM.length(); i++)
+            TMMachineDescription description;
+            for(MyStateItem *state : m_TM)
+                state->describe(description);
+
+            //Give the description to the machine model. A machine that fails to build leaves the last one in place:
+            TuringMachine *model = new TuringMachine(description);
+            if(!model->build())
             {
-                entry = m_TM[i]->getStateData();
-                statesData.append(entry);
+                PopUpMessagebox *buildFailed = new PopUpMessagebox(this, "TM could not be built", model->getErrorString(),
+                                                                   QPixmap(":/new/prefix1/Images and Icons/warning.png"));
+                buildFailed->show();
+                delete model;
+                return;
             }
-
-            //Give the data to the machine model:
             if(m_TMModel != nullptr)
                 delete m_TMModel;
-            m_TMModel = new TuringMachine(statesData);
-            m_TMModel->build();
+            m_TMModel = model;
 
-            //Update the summary table:
-            this->populateSummaryTable(m_TMModel->getSummaryTableData());
+            //Update the summary table. The old profile belongs to the previous build:
+            this->populateSummaryTable(m_TMModel);
+            m_ProfilePage->clear();
+            this->showHeatMap(false);
+            m_DebuggerPanel->clearRun();
+            ui->executionSummary->clearRun();
 
             //Inform the user that the machine built successfully:
             PopUpMessagebox *success = new PopUpMessagebox(this, "TM built successfully", "Your TM was built successfully."
@@ -751,13 +761,9 @@ void TuringMachineWindow::testInputButtonClicked()
     }
     else
     {
-        // Stop the timers if they are running
-        if(m_MoveLeftTimer->isActive())
-            m_MoveLeftTimer->stop();
-        if(m_MoveRightTimer->isActive())
-            m_MoveRightTimer->stop();
-        if(m_PauseTimer->isActive())
-            m_PauseTimer->stop();
+        // Stop the animation if it is playing
+        m_Animator->stop();
+        ui->skipAnimationButton->setEnabled(false);
 
         // Disable the lear button
          ui->clearPushButton->setEnabled(false);
@@ -765,8 +771,9 @@ void TuringMachineWindow::testInputButtonClicked()
         // Set the input edit as read-only
         ui->inputLineEdit->setReadOnly(true);
 
-        // Disable tape length spinbox
+        // Disable tape length and step limit spinboxes
         ui->tapeLengthSpinBox->setReadOnly(true);
+        ui->maxStepsSpinBox->setReadOnly(true);
 
         //Reset TM colors:
         for(MyStateItem *s: m_TM)
@@ -775,41 +782,150 @@ void TuringMachineWindow::testInputButtonClicked()
         //Reset the tape:
         this->on_inputLineEdit_editingFinished();
 
-        //Get the input string, set parameters and test the string:
+        //Get the input string, set parameters and test the string on a worker thread:
         QString input = ui->inputLineEdit->text() + '-';
         m_Processor->setParameters(input, m_TMModel);
-        TMProcessor::ProcessResult result = m_Processor->start();
-
-        if(result == TMProcessor::Successful)
-        {
-            //Play the hops:
-            m_MachineData = m_Processor->getMachineData();
-            m_TapeData = m_Processor->getTapeData();
 
-            m_CurrentCell = 0;
-            m_TapeCounter = 0;
-            m_Count = 0;
+        //The step limit is set in the options tab. The trace is kept for the animation, so cap its memory:
+        TMRunConfig config;
+        config.setMaxSteps(quint64(m_MaxSteps) * 1000000);
+        config.setMaxTraceMemory(std::size_t(1) << 30);
+        config.setCycleDetectionEnabled(true);
+        config.setTranslatedCycleDetectionEnabled(true);
+        m_Processor->setRunConfig(config);
+
+        //A TM with several edges for the same state and symbol is searched breadth first. The animation plays the accepting branch:
+        m_Processor->setExecutionMode(m_TMModel->getCompiledMachine().isDeterministic() ? TMProcessor::Compiled
+                                                                                         : TMProcessor::Nondeterministic);
+        //The trace is rewritten by the run, so the debugger and summary let go of it until the run is done:
+        m_DebuggerPanel->clearRun();
+        ui->executionSummary->clearRun();
+        this->setRunControlsEnabled(true);
+        if(m_Processor->getExecutionMode() == TMProcessor::Nondeterministic)
+            ui->statusbar->showMessage("Searching the branches of a nondeterministic TM. It can be stopped, but not paused.");
+        m_Processor->startAsync();
+    }
+}
 
-            m_TapeHeadStartXPos = 5 + (m_CellWidth / 2.0) - m_TapeHead->sceneBoundingRect().width()/2.0;
-            this->play();
+void TuringMachineWindow::processingFinished(int result)
+{
+    this->setRunControlsEnabled(false);
+    this->displayProfile();
+    m_DebuggerPanel->setRun(&m_Processor->getTrace(), m_TMModel, m_Processor);
 
-            //Display the test summary:
-            this->displayTestSummary();
-        }
+    if(result == TMProcessor::Successful)
+    {
+        //Play the hops. A rejected nondeterministic run has no branch to play:
+        if(m_Processor->getTrace().isEmpty())
+            this->animationFinished();
         else
         {
-            QString message = "There is a possible infinite loop in your TM.\n"
-                              "1 000 000 read, write and move iterations where executed.\n"
-                              "Please revise your TM design so as to remove the infinite loop.\n\n"
-                              "Hint\n- See the help section for help identifying infinite loops.";
-
-            PopUpMessagebox *infLoopMessage = new PopUpMessagebox(this, "Infinite loop warning", message,
-                                                                 QPixmap(":/new/prefix1/Images and Icons/warning.png"));
-            infLoopMessage->show();
+            ui->skipAnimationButton->setEnabled(true);
+            m_Animator->start(&m_Processor->getTrace());
         }
+
+        //Display the test summary:
+        this->displayTestSummary();
+        return;
+    }
+
+    // Re-enable everything that was disabled
+    ui->clearPushButton->setEnabled(true);
+    ui->inputLineEdit->setReadOnly(false);
+    ui->tapeLengthSpinBox->setReadOnly(false);
+    ui->maxStepsSpinBox->setReadOnly(false);
+
+    if(result == TMProcessor::Cancelled)
+    {
+        ui->statusbar->showMessage(QString("Test stopped after %1 steps.") .arg(m_Processor->getSteps()), 5000);
+    }
+    else if(result == TMProcessor::StepLimitReached)
+    {
+        QString message = QString("There is a possible infinite loop in your TM.\n"
+                                  "%1 read, write and move iterations where executed.\n"
+                                  "Please revise your TM design so as to remove the infinite loop,\n"
+                                  "or raise the step limit in the options tab.\n\n"
+                                  "Hint\n- See the help section for help identifying infinite loops.")
+                              .arg(QLocale().toString(m_Processor->getSteps()));
+
+        PopUpMessagebox *infLoopMessage = new PopUpMessagebox(this, "Infinite loop warning", message,
+                                                             QPixmap(":/new/prefix1/Images and Icons/warning.png"));
+        infLoopMessage->show();
+    }
+    else if(result == TMProcessor::CycleDetected)
+    {
+        const TMCycleDetector &cycle = m_Processor->getCycleDetector();
+        QString message = QString("Your TM has an infinite loop.\n"
+                                  "From step %1 on it returns to the same state, tape and head position every %2 steps,\n"
+                                  "so it will never halt.\n"
+                                  "Please revise your TM design so as to remove the infinite loop.\n\n"
+                                  "Hint\n- See the help section for help identifying infinite loops.")
+                              .arg(QLocale().toString(qulonglong(cycle.getCycleStart())), QLocale().toString(qulonglong(cycle.getCycleLength())));
+
+        PopUpMessagebox *infLoopMessage = new PopUpMessagebox(this, "Infinite loop", message,
+                                                             QPixmap(":/new/prefix1/Images and Icons/warning.png"));
+        infLoopMessage->show();
+    }
+    else if(result == TMProcessor::TranslatedCycleDetected)
+    {
+        const TMTranslatedCycleDetector &cycle = m_Processor->getTranslatedCycleDetector();
+        QString message = QString("Your TM has an infinite loop.\n"
+                                  "From step %1 on it repeats the same moves every %2 steps while moving %3 cells to the %4,\n"
+                                  "so it will never halt.\n"
+                                  "Please revise your TM design so as to remove the infinite loop.\n\n"
+                                  "Hint\n- See the help section for help identifying infinite loops.")
+                              .arg(QLocale().toString(qulonglong(cycle.getCycleStart())),
+                                   QLocale().toString(qulonglong(cycle.getPeriod())))
+                              .arg(qAbs(cycle.getOffset()))
+                              .arg(cycle.getOffset() > 0 ? "right" : "left");
+
+        PopUpMessagebox *infLoopMessage = new PopUpMessagebox(this, "Infinite loop", message,
+                                                             QPixmap(":/new/prefix1/Images and Icons/warning.png"));
+        infLoopMessage->show();
+    }
+    else
+    {
+        QString message = QString("The test was stopped after %1 steps.\n%2.")
+                              .arg(QLocale().toString(m_Processor->getSteps()), m_Processor->getLimitString(TMProcessor::ProcessResult(result)));
+
+        PopUpMessagebox *limitMessage = new PopUpMessagebox(this, "Run limit reached", message,
+                                                            QPixmap(":/new/prefix1/Images and Icons/warning.png"));
+        limitMessage->show();
     }
 }
 
+void TuringMachineWindow::showRunProgress(quint64 steps, double stepsPerSecond, qint64 leftmost, qint64 rightmost)
+{
+    ui->statusbar->showMessage(QString("Step %1  |  %2 steps/s  |  Tape cells %3 to %4")
+                                   .arg(steps) .arg(stepsPerSecond, 0, 'f', 0) .arg(leftmost) .arg(rightmost));
+}
+
+void TuringMachineWindow::on_pauseRunButton_clicked()
+{
+    bool pause = !m_Processor->isPaused();
+    m_Processor->setPaused(pause);
+    ui->pauseRunButton->setText(pause ? "Resume" : "Pause");
+}
+
+void TuringMachineWindow::on_stopRunButton_clicked()
+{
+    m_Processor->cancel();
+}
+
+void TuringMachineWindow::setRunControlsEnabled(bool running)
+{
+    //Keep the model untouched while the worker is using it:
+    ui->testInputButton->setEnabled(!running);
+    ui->buildButton->setEnabled(!running);
+    ui->clearSceneButton->setEnabled(!running);
+    ui->actionLoadTM->setEnabled(!running);
+    ui->actionBatchTest->setEnabled(!running);
+    ui->actionEnumerateLanguage->setEnabled(!running);
+    ui->stopRunButton->setEnabled(running);
+    ui->pauseRunButton->setEnabled(running && m_Processor->getExecutionMode() != TMProcessor::Nondeterministic);
+    ui->pauseRunButton->setText("Pause");
+}
+
 void TuringMachineWindow::clearSceneButtonClicked()
 {
     for(int i = 0; i < m_TM.length(); i++)
@@ -819,7 +935,7 @@ void TuringMachineWindow::clearSceneButtonClicked()
     }
     m_NumOfStates = 0;
     m_TM.clear();
-    m_TableModel->setRowCount(0);
+    m_TableModel->clear();
     m_FileLoaded = false;
     m_LoadedFile = "";
     m_LoadedDescription = "";
@@ -836,7 +952,9 @@ void TuringMachineWindow::clearSceneButtonClicked()
 
     m_NumOfStates = 0;
     ui->crashMessageLabel->setText("Reason for crash will appear here");
-    ui->textEdit->clear();
+    ui->executionSummary->clearRun();
+    m_ProfilePage->clear();
+    m_DebuggerPanel->clearRun();
 }
 
 void TuringMachineWindow::on_inputLineEdit_editingFinished()
@@ -844,113 +962,82 @@ void TuringMachineWindow::on_inputLineEdit_editingFinished()
     //Clear the tape view:
     this->clearTapeView();
 
+    //Split the input into the built machine's symbols, or into characters before anything is built:
+    QString inputString = ui->inputLineEdit->text();
+    QStringList symbols;
+    if(m_TMModel != nullptr)
+        symbols = m_TMModel->tokenize(inputString);
+    else
+    {
+        for(const QChar &c : inputString)
+            symbols.append(c);
+    }
+
     //Enter the string in the tape:
-    if(!m_Tape.isEmpty())
+    for(int i = 0; i < symbols.length(); i++)
     {
-        QString inputString = ui->inputLineEdit->text();
-        for(int i = 0; i < inputString.length(); i++)
-        {
-            //In case the input string is longer than the tape:
-            if(i == m_TapeLength - 1)
-                break;
-            m_Tape[i]->setLabel(inputString[i]);
-        }
+        //In case the input string is longer than the tape:
+        if(i == m_TapeLength - 1)
+            break;
+        ui->tapeView->writeCell(i, symbols[i]);
     }
 }
 
-void TuringMachineWindow::play()
+void TuringMachineWindow::applyAnimationSteps(quint64 from, quint64 to)
 {
-    if(m_Count < m_MachineData.length() - 1)
-    {
-        //Change the previous state's color to white:
-        if(m_Count > 0)
-            m_TM[m_MachineData[m_Count]]->changeColor(Qt::white);
-
-        //Change the current state's color:
-        if(m_MachineData.length() > m_Count + 1)
-            m_TM[m_MachineData[m_Count + 1]]->changeColor(m_CSCColor);
+    const TMTrace &trace = m_Processor->getTrace();
 
-        //Move tapehead:
-        this->moveTapeHead();
-        m_Count++;
+    //Write the steps' symbols on the tape. A large batch is cheaper to load from a snapshot of the trace:
+    if(to - from > MaxAnimationWrites)
+    {
+        TMTraceSnapshot snapshot = trace.getSnapshot(to);
+        ui->tapeView->setCells(snapshot.leftmost, snapshot.cells, m_Processor->getSymbolNames());
     }
     else
     {
-        //Change the last state that the input got us to green if the word was accepted otherwise red:
-        if(m_Processor->getCrashString() == "")
-            m_TM[m_MachineData[m_Count]]->changeColor(Qt::green);
-        else
-            m_TM[m_MachineData[m_Count]]->changeColor(Qt::red);
-
-        // Re-enable everything that was disabled
-        ui->clearPushButton->setEnabled(true);
-        ui->inputLineEdit->setReadOnly(false);
-        ui->tapeLengthSpinBox->setReadOnly(false);
+        for(quint64 i = from; i < to; i++)
+        {
+            const TMTraceStep &step = trace.getStep(i);
+            ui->tapeView->writeCell(step.head, m_Processor->getSymbolName(step.newSymbol));
+        }
     }
-}
 
-void TuringMachineWindow::unpause()
-{
-    m_TapeHead->setBrush(Qt::black);
-    m_PauseTimer->stop();
-    emit this->doneMoving();
+    //Change the previous state's color to white and colour the current state:
+    m_TM[trace.getStep(from).fromState]->changeColor(Qt::white);
+    m_TM[trace.getStep(to - 1).toState]->changeColor(m_CSCColor);
 }
 
-void TuringMachineWindow::moveTapeHead()
+void TuringMachineWindow::moveAnimatedHead(qreal position, bool resting)
 {
-    //Move tape head:
-    if(m_TapeCounter < m_TapeData.length() - 1)
-    {
-        m_MoveCounter = 0;
-        m_PrevHeadPos = m_TapeHead->scenePos();
-
-        //Write letter on tape:
-        m_Tape[m_CurrentCell]->setLabel(m_TapeData[m_TapeCounter][0]);
-
-        if(m_TapeData[m_TapeCounter][1].toLower() == QString("l"))
-        {
-            m_MoveLeftTimer->start();
-            m_CurrentCell--;
-
-        }
-        else if(m_TapeData[m_TapeCounter][1].toLower() == QString("r"))
-        {
-            m_MoveRightTimer->start();
-            m_CurrentCell++;
-        }
-    }
+    //The head turns white while it rests on a cell:
+    ui->tapeView->setHeadPosition(position, resting);
 }
 
-void TuringMachineWindow::moveLeft()
+void TuringMachineWindow::animationFinished()
 {
-    if(m_MoveCounter < m_CellWidth)
-    {
-        m_TapeHead->setPos(m_TapeHead->pos().x() - 1, m_TapeHead->scenePos().y());
-        m_MoveCounter++;
-    }
-    else
+    //Change the last state that the input got us to green if the word was accepted otherwise red.
+    //An empty trace reached no state worth colouring:
+    const TMTrace &trace = m_Processor->getTrace();
+    if(!trace.isEmpty())
     {
-        m_MoveLeftTimer->stop();
-        m_TapeCounter++;
-        m_TapeHead->setBrush(Qt::white);
-        m_PauseTimer->start();
+        if(m_Processor->getCrashString() == "")
+            m_TM[trace.getFinalState()]->changeColor(Qt::green);
+        else
+            m_TM[trace.getFinalState()]->changeColor(Qt::red);
     }
+
+    // Re-enable everything that was disabled
+    ui->tapeView->setHeadPosition(ui->tapeView->getHeadPosition(), false);
+    ui->skipAnimationButton->setEnabled(false);
+    ui->clearPushButton->setEnabled(true);
+    ui->inputLineEdit->setReadOnly(false);
+    ui->tapeLengthSpinBox->setReadOnly(false);
+    ui->maxStepsSpinBox->setReadOnly(false);
 }
 
-void TuringMachineWindow::moveRight()
+void TuringMachineWindow::on_skipAnimationButton_clicked()
 {
-    if(m_MoveCounter < m_CellWidth)
-    {
-        m_TapeHead->setPos(m_TapeHead->scenePos().x() + 1, m_TapeHead->scenePos().y());
-        m_MoveCounter++;
-    }
-    else
-    {
-        m_MoveRightTimer->stop();
-        m_TapeCounter++;
-        m_TapeHead->setBrush(Qt::white);
-        m_PauseTimer->start();
-    }
+    m_Animator->skipToEnd();
 }
 
 void TuringMachineWindow::on_clearPushButton_clicked()
@@ -1260,6 +1347,56 @@ void TuringMachineWindow::on_actionLoadTM_triggered()
     }
 }
 
+void TuringMachineWindow::on_actionBatchTest_triggered()
+{
+    if(m_TMModel == nullptr)
+    {
+        QString message = "No TM detected. \n\nPlease click the \"Build\" button after designing your TM to build it before testing input.";
+        PopUpMessagebox *noTMDetected = new PopUpMessagebox(this, "No TM Detected", message, QPixmap(":/new/prefix1/Images and Icons/warning.png"));
+        noTMDetected->show();
+        return;
+    }
+
+    //Same budget as a single test, without a trace. Cycle detection turns endless runs into LOOP results:
+    TMRunConfig config;
+    config.setMaxSteps(quint64(m_MaxSteps) * 1000000);
+    config.setCycleDetectionEnabled(true);
+    config.setTranslatedCycleDetectionEnabled(true);
+    TMProcessor::ExecutionMode mode = m_TMModel->getCompiledMachine().isDeterministic() ? TMProcessor::Compiled
+                                                                                        : TMProcessor::Nondeterministic;
+
+    //Modal, so the model cannot be rebuilt while the inputs run:
+    BatchTestDialog batchDialog(m_TMModel, config, mode, this);
+    batchDialog.exec();
+}
+
+void TuringMachineWindow::on_actionEnumerateLanguage_triggered()
+{
+    if(m_TMModel == nullptr)
+    {
+        QString message = "No TM detected. \n\nPlease click the \"Build\" button after designing your TM to build it before testing input.";
+        PopUpMessagebox *noTMDetected = new PopUpMessagebox(this, "No TM Detected", message, QPixmap(":/new/prefix1/Images and Icons/warning.png"));
+        noTMDetected->show();
+        return;
+    }
+
+    //Every string gets the step limit of a single test:
+    TMRunConfig config;
+    config.setMaxSteps(quint64(m_MaxSteps) * 1000000);
+    config.setCycleDetectionEnabled(true);
+    config.setTranslatedCycleDetectionEnabled(true);
+
+    //Modal, so the model cannot be rebuilt while the strings run:
+    LanguageDialog languageDialog(m_TMModel, config, this);
+    languageDialog.exec();
+}
+
+void TuringMachineWindow::on_actionDebugger_triggered()
+{
+    m_DebuggerDock->show();
+    m_DebuggerDock->raise();
+}
+
 void TuringMachineWindow::on_actionExit_triggered()
 {    
     this->quitApp();
@@ -1315,48 +1452,21 @@ void TuringMachineWindow::changeCSCColor()
 void TuringMachineWindow::speedSpinBoxValueChanged(int val)
 {
     m_Speed = val;
-    if(m_Speed <= 3)
-    {
-        m_PauseTimer->setInterval(1/m_Speed * 500);
-        m_MoveLeftTimer->setInterval(10);
-        m_MoveRightTimer->setInterval(10);
-    }
-    else
-    {
-        m_MoveLeftTimer->setInterval(12 - m_Speed);
-        m_MoveRightTimer->setInterval(12 - m_Speed);
-    }
+    m_Animator->setStepsPerSecond(playbackRate(m_Speed));
     m_SettingsChanged = true;
 }
 
 void TuringMachineWindow::tapeLengthSpinBoxValueChanged(int val)
 {
+    //The tape view only draws the cells in sight, so nothing is rebuilt:
     m_TapeLength = val;
+    ui->tapeView->setLength(m_TapeLength);
+    m_SettingsChanged = true;
+}
 
-    // Clear tape scene
-    m_Tape.clear();
-
-    //Recreate tape scene
-    if(m_TapeScene)
-        delete m_TapeScene;
-    m_TapeScene = new QGraphicsScene(this);
-    ui->tapeGraphicsView->setScene(m_TapeScene);
-
-    //Set up tape head:
-    m_TapeHead = new TapeHead(this);
-    m_TapeScene->addItem(m_TapeHead);
-    m_TapeHead->setPos(m_TapeHeadStartXPos, 1);
-
-    //Set up the tape:
-    qreal offset = 0;
-    for(int i = 0; i < m_TapeLength; i++)
-    {
-        SquareTapeCell *temp = new SquareTapeCell(QRectF(5 + offset, 16, m_CellWidth, m_CellWidth));
-        m_Tape.append(temp);
-        temp->setLabel("-");
-        m_TapeScene->addItem(temp);
-        offset += m_CellWidth;
-    }
+void TuringMachineWindow::maxStepsSpinBoxValueChanged(int val)
+{
+    m_MaxSteps = val;
     m_SettingsChanged = true;
 }
 
@@ -1529,3 +1639,48 @@ void TuringMachineWindow::resetConnections()
     emit this->scaleChanged();
 }
 
+void TuringMachineWindow::showHeatMap(bool enabled)
+{
+    //Ring every state by its share of the steps, relative to the busiest state:
+    const TMProfile &profile = m_ProfilePage->getProfile();
+    quint64 busiest = 1;
+    for(int i = 0; i < profile.getNumStates(); i++)
+        busiest = qMax<quint64>(busiest, profile.getStateHits(i));
+
+    for(int i = 0; i < m_TM.length(); i++)
+    {
+        if(!enabled || profile.isEmpty() || i >= profile.getNumStates())
+        {
+            m_TM[i]->clearHeat();
+            continue;
+        }
+        quint64 hits = profile.getStateHits(i);
+        double share = profile.getSteps() > 0 ? 100.0 * hits / profile.getSteps() : 0.0;
+        m_TM[i]->setHeat(qreal(hits) / busiest, QString("%1: %2 steps (%3%)") .arg(m_TM[i]->getStateName())
+                                                     .arg(QLocale().toString(qulonglong(hits))) .arg(share, 0, 'f', 2));
+    }
+}
+
+void TuringMachineWindow::showDebuggerConfiguration()
+{
+    //Stepping through the run takes over from the animation:
+    if(!m_DebuggerPanel->hasRun())
+        return;
+    this->stopAnimation();
+    const TMDebugger &debugger = m_DebuggerPanel->getDebugger();
+    const TMTraceSnapshot &configuration = debugger.getConfiguration();
+
+    //Colour the current state, or the final one as the animation leaves it:
+    for(MyStateItem *s : m_TM)
+        s->changeColor(Qt::white);
+    if(debugger.getState() >= 0 && debugger.getState() < m_TM.length())
+    {
+        QColor color = m_CSCColor;
+        if(debugger.isAtEnd())
+            color = m_Processor->getCrashString() == "" ? Qt::green : Qt::red;
+        m_TM[debugger.getState()]->changeColor(color);
+    }
+
+    ui->tapeView->setCells(configuration.leftmost, configuration.cells, m_Processor->getSymbolNames());
+    ui->tapeView->setHeadPosition(debugger.getHeadPosition(), false);
+}
@@ -20,7 +20,7 @@
 #include <QGraphicsScene>
 #include <QTimer>
 #include <QTableView>
-#include <QStandardItemModel>
+#include <QSortFilterProxyModel>
 #include <QLineEdit>
 #include <QTextEdit>
 #include <QSpinBox>
@@ -30,11 +30,13 @@
 #include "squarespawnbox.h"
 #include "turingmachine.h"
 #include "tmprocessor.h"
-#include "squaretapecell.h"
 #include "tapecell.h"
-#include "tapehead.h"
+#include "tapeanimator.h"
 #include "colorbutton.h"
 #include "tmsscene.h"
+#include "profilepage.h"
+#include "debuggerpanel.h"
+#include "summarytablemodel.h"
 
 
 QT_BEGIN_NAMESPACE
@@ -55,14 +57,17 @@ public:
     void setupSummaryPage();
     void setupOptionsPage();
     void setupHelpPage();
-    void populateSummaryTable(QStringList tableData);
+    void setupProfilePage();
+    void setupDebugger();
+    void populateSummaryTable(const TuringMachine *theTM);
     void displayTestSummary();
+    void displayProfile();
+    void stopAnimation();
+    void setRunControlsEnabled(bool running);
     void loadSettings();
     void quitApp();
 
 signals:
-    void doneMoving();
-
     void scaleChanged();
 
 private slots:
@@ -87,19 +92,25 @@ private slots:
 
     void testInputButtonClicked();
 
+    void processingFinished(int result);
+
+    void showRunProgress(quint64 steps, double stepsPerSecond, qint64 leftmost, qint64 rightmost);
+
+    void on_pauseRunButton_clicked();
+
+    void on_stopRunButton_clicked();
+
     void clearSceneButtonClicked();
 
     void on_inputLineEdit_editingFinished();
 
-    void moveTapeHead();
-
-    void moveLeft();
+    void applyAnimationSteps(quint64 from, quint64 to);
 
-    void moveRight();
+    void moveAnimatedHead(qreal position, bool resting);
 
-    void play();
+    void animationFinished();
 
-    void unpause();
+    void on_skipAnimationButton_clicked();
 
     void on_clearPushButton_clicked();
 
@@ -107,6 +118,12 @@ private slots:
 
     void on_actionLoadTM_triggered();
 
+    void on_actionBatchTest_triggered();
+
+    void on_actionEnumerateLanguage_triggered();
+
+    void on_actionDebugger_triggered();
+
     void on_actionExit_triggered();
 
     void getSaveFileLocation();
@@ -119,6 +136,8 @@ private slots:
 
     void tapeLengthSpinBoxValueChanged(int val);
 
+    void maxStepsSpinBoxValueChanged(int val);
+
     void aboutAppButtonClicked();
 
     void aboutQtButtonClicked();
@@ -135,28 +154,28 @@ private slots:
 
     void resetConnections();
 
+    void showHeatMap(bool enabled);
+
+    void showDebuggerConfiguration();
+
+    void filterSummaryTable();
+
 private:
+    //Larger animation batches are drawn from a snapshot of the trace instead of one write per step:
+    enum {MaxAnimationWrites = 4096};
+
     Ui::TuringMachineWindow *ui;
     TMSScene *m_Scene;
-    QGraphicsScene *m_TapeScene;
     QGraphicsScene *m_SummaryPageScene;
     QGraphicsScene *m_ESScene;
     QGraphicsScene *m_OptionsScene;
     QGraphicsScene *m_HelpScene;
     QGraphicsScene *m_SlidesScene;
     SquareSpawnBox *m_SpawnBox;
-    TapeHead *m_TapeHead;
-    QTimer *m_MoveLeftTimer;
-    QTimer *m_MoveRightTimer;
-    QTimer *m_PauseTimer;
+    TapeAnimator *m_Animator;
     QTimer *m_DescTimer;
     QTimer *m_LogoTimer;
-    QPointF m_PrevHeadPos;
-    qreal m_TapeHeadStartXPos;
     QList<MyStateItem*> m_TM;
-    QList<SquareTapeCell*> m_Tape;
-    QList<int> m_MachineData;
-    QStringList m_TapeData;
     QStringList m_SummaryTableData;
 
     QLineEdit *m_CrashMessegeEdit;
@@ -183,19 +202,19 @@ private:
     QGraphicsTextItem *m_CSCColorLabel;
 
     QTableView *m_SummaryTable;
-    QStandardItemModel *m_TableModel;
+    SummaryTableModel *m_TableModel;
+    QSortFilterProxyModel *m_TableProxy;
     QGraphicsView *m_ESView;
+    ProfilePage *m_ProfilePage;
+    QDockWidget *m_DebuggerDock;
+    DebuggerPanel *m_DebuggerPanel;
 
     QGraphicsRectItem *m_AcceptedRect;
     QGraphicsRectItem *m_CrashedRect;
 
     int m_NumOfStates;
-    int m_CurrentCell;
-    int m_Count;
-    int m_TapeCounter;
-    int m_MoveCounter;
     int m_TapeLength;
-    int m_CellWidth;
+    int m_MaxSteps;
     bool m_HasHALTState;
     bool m_HasSTARTState;
     bool m_SettingsChanged;
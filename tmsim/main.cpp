@@ -0,0 +1,307 @@
+/*(C)Copyright 2023 Malone Napier-Jameson
+ *
+ * This file is part of Turing Machine Simulator.
+ * Turing Machine Simulator is free software: you can redistribute it and/or modify it under the terms of
+ * the GNU Lesser General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ * Turing Machine Simulator is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public License along with Turing Machine Simulator.
+ * There is also a copy available inside the application.
+ * If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QScopedPointer>
+#include <QTextStream>
+#include "turingmachine.h"
+#include "tmbatchrunner.h"
+#include "tmequivalencechecker.h"
+#include "tmlanguageenumerator.h"
+#include "tmprocessor.h"
+#include "tmxmlloader.h"
+
+//Prints the verdict of an equivalence check and returns the exit status:
+static int reportEquivalence(const TMEquivalenceChecker &checker, QTextStream &out, QTextStream &err)
+{
+    switch(checker.getStatus())
+    {
+    case TMEquivalenceChecker::Invalid:
+        err << checker.getErrorString() << '\n';
+        return 2;
+    case TMEquivalenceChecker::Equivalent:
+        out << "EQUIVALENT\n";
+        break;
+    case TMEquivalenceChecker::Inconclusive:
+        out << "INCONCLUSIVE\tno counterexample, but " << checker.getNumUndecided() << " strings ran out of steps\n";
+        break;
+    case TMEquivalenceChecker::CounterexampleFound:
+        out << "COUNTEREXAMPLE\t\"" << checker.getCounterexample() << "\"\n";
+        for(int i = 0; i < 2; i++)
+        {
+            out << "\nMachine " << i + 1 << ": " << checker.getOutcome(i) << '\n';
+            if(!checker.getTrace(i).isEmpty())
+                out << checker.getTrace(i) << '\n';
+        }
+        break;
+    }
+    out.flush();
+
+    err << checker.getNumStrings() << " strings compared";
+    if(checker.isPrefixCached())
+        err << " (" << checker.getNumSettledByPrefix() << " settled by a shared prefix)";
+    err << ", " << checker.getTotalSteps() << " steps in " << checker.getElapsedTime() << " ms\n";
+    return checker.getStatus() == TMEquivalenceChecker::Equivalent ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName("tmsim");
+
+    //Command line options:
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Runs inputs on a TM saved by Turing Machine Simulator without opening a window.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("machine", "The saved TM (.xml) to run.");
+    parser.addPositionalArgument("inputs", "Inputs to test. Read from standard input when none are given.", "[inputs...]");
+    QCommandLineOption fileOption(QStringList() << "f" << "file", "Read inputs from <file>, one per line, each optionally followed by "
+                                                                     "a tab and the expected outcome.", "file");
+    QCommandLineOption twoWayOption("two-way", "Use a tape that is also unbounded to the left of the first cell.");
+    QCommandLineOption interpretedOption("interpreted", "Use the interpreted engine instead of the compiled one.");
+    QCommandLineOption acceleratedOption("accelerated", "Run on a run-length encoded tape, applying self-loop transitions "
+                                                        "across whole runs of a symbol. Gives the same results, much faster "
+                                                        "for machines that sweep over long blocks.");
+    QCommandLineOption enumerateOption("enumerate", "Instead of running inputs, run every string of up to <n> symbols and print "
+                                                    "the accepted ones, shortest first.", "n");
+    QCommandLineOption alphabetOption("alphabet", "The symbols for --enumerate, separated by spaces. Defaults to every "
+                                                  "non-blank symbol the TM reads.", "symbols");
+    QCommandLineOption compareOption("compare", "Instead of printing results, check that <other> accepts the same inputs "
+                                                "(or with --enumerate, the same strings) and print the first counterexample "
+                                                "with both traces.", "other");
+    QCommandLineOption maxStepsOption("max-steps", "Stop each run after <n> steps, 0 for no limit (default 100000000).", "n",
+                                      QString::number(TMRunConfig::DefaultMaxSteps));
+    QCommandLineOption maxCellsOption("max-cells", "Stop each run once it has visited <n> tape cells, 0 for no limit.", "n",
+                                      QString::number(TMRunConfig::DefaultMaxTapeCells));
+    QCommandLineOption cyclesOption("detect-cycles", "Stop runs that repeat a configuration, possibly shifted along the tape, "
+                                                      "and report them as LOOP.");
+    QCommandLineOption maxConfigurationsOption("max-configurations", "Stop the breadth first search of a nondeterministic TM "
+                                                                      "after <n> configurations, 0 for no limit (default 1048576).", "n",
+                                               QString::number(TMRunConfig::DefaultMaxConfigurations));
+    QCommandLineOption maxTimeOption("max-time", "Stop each run after <ms> milliseconds, 0 for no limit (default).", "ms", "0");
+    parser.addOption(fileOption);
+    parser.addOption(maxStepsOption);
+    parser.addOption(maxCellsOption);
+    parser.addOption(maxTimeOption);
+    parser.addOption(maxConfigurationsOption);
+    parser.addOption(cyclesOption);
+    parser.addOption(twoWayOption);
+    parser.addOption(interpretedOption);
+    parser.addOption(acceleratedOption);
+    parser.addOption(enumerateOption);
+    parser.addOption(alphabetOption);
+    parser.addOption(compareOption);
+    parser.process(a);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    QStringList arguments = parser.positionalArguments();
+    if(arguments.isEmpty())
+    {
+        err << "No machine given.\n\n" << parser.helpText();
+        return 2;
+    }
+
+    //Read the run budget:
+    bool stepsOk = false;
+    bool cellsOk = false;
+    bool timeOk = false;
+    bool configurationsOk = false;
+    TMRunConfig config;
+    config.setMaxSteps(parser.value(maxStepsOption).toULongLong(&stepsOk));
+    config.setMaxTapeCells(parser.value(maxCellsOption).toULongLong(&cellsOk));
+    config.setMaxWallTime(parser.value(maxTimeOption).toLongLong(&timeOk));
+    config.setMaxConfigurations(parser.value(maxConfigurationsOption).toULongLong(&configurationsOk));
+    config.setCycleDetectionEnabled(parser.isSet(cyclesOption));
+    config.setTranslatedCycleDetectionEnabled(parser.isSet(cyclesOption));
+    if(!stepsOk || !cellsOk || !timeOk || !configurationsOk || config.getMaxWallTime() < 0)
+    {
+        err << "Invalid limit.\n\n" << parser.helpText();
+        return 2;
+    }
+
+    //Load and build the machine:
+    TMXmlLoader loader;
+    if(!loader.load(arguments.takeFirst()))
+    {
+        err << "Error reading file: " << loader.getErrorString() << '\n';
+        return 1;
+    }
+    TuringMachine machine(loader.getMachine());
+    if(!machine.build())
+    {
+        err << "Error building machine: " << machine.getErrorString() << '\n';
+        return 1;
+    }
+
+    //The machine to compare against:
+    QScopedPointer<TuringMachine> other;
+    TMEquivalenceChecker checker;
+    if(parser.isSet(compareOption))
+    {
+        TMXmlLoader otherLoader;
+        if(!otherLoader.load(parser.value(compareOption)))
+        {
+            err << "Error reading file: " << otherLoader.getErrorString() << '\n';
+            return 1;
+        }
+        other.reset(new TuringMachine(otherLoader.getMachine()));
+        if(!other->build())
+        {
+            err << "Error building machine: " << other->getErrorString() << '\n';
+            return 1;
+        }
+        checker.setMachines(&machine, other.data());
+        checker.setLeftBounded(!parser.isSet(twoWayOption));
+        checker.setRunConfig(config);
+        if(parser.isSet(alphabetOption))
+            checker.setAlphabet(parser.value(alphabetOption).split(' ', Qt::SkipEmptyParts));
+    }
+
+    //Enumerate the language up to a length:
+    if(parser.isSet(enumerateOption))
+    {
+        bool lengthOk = false;
+        int maxLength = parser.value(enumerateOption).toInt(&lengthOk);
+        if(!lengthOk || maxLength < 0)
+        {
+            err << "Invalid length.\n\n" << parser.helpText();
+            return 2;
+        }
+
+        if(!other.isNull())
+        {
+            checker.checkUpTo(maxLength);
+            return reportEquivalence(checker, out, err);
+        }
+
+        TMLanguageEnumerator enumerator;
+        enumerator.setMachine(&machine);
+        enumerator.setMaxLength(maxLength);
+        enumerator.setLeftBounded(!parser.isSet(twoWayOption));
+        enumerator.setRunConfig(config);
+        if(parser.isSet(alphabetOption))
+            enumerator.setAlphabet(parser.value(alphabetOption).split(' ', Qt::SkipEmptyParts));
+        if(!enumerator.run())
+        {
+            err << enumerator.getErrorString() << '\n';
+            return 1;
+        }
+
+        //Accepted strings on standard output, counts by length on standard error:
+        for(int length = 0; length <= maxLength && length < enumerator.getCounts().length(); length++)
+            for(const QString &string : enumerator.getAcceptedStrings(length))
+                out << string << '\n';
+        out.flush();
+
+        err << "Alphabet: " << enumerator.getAlphabet().join(' ') << '\n';
+        err << "length\tstrings\taccepted\trejected\tundecided\n";
+        for(int length = 0; length < enumerator.getCounts().length(); length++)
+        {
+            const TMLanguageEnumerator::LengthCounts &counts = enumerator.getCounts()[length];
+            err << length << '\t' << counts.strings << '\t' << counts.accepted << '\t' << counts.rejected << '\t'
+                << counts.undecided << '\n';
+        }
+        err << enumerator.getNumStrings() << " strings in " << enumerator.getElapsedTime() << " ms\n";
+        return 0;
+    }
+
+    //Gather the inputs:
+    QVector<TMBatchRunner::Case> cases;
+    for(const QString &input : arguments)
+        cases.append(TMBatchRunner::Case{input, TMBatchRunner::AnyOutcome});
+    if(parser.isSet(fileOption))
+    {
+        QFile inputFile(parser.value(fileOption));
+        if(!inputFile.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            err << "Could not open " << inputFile.fileName() << ": " << inputFile.errorString() << '\n';
+            return 1;
+        }
+        QTextStream inStream(&inputFile);
+        QString error;
+        if(!TMBatchRunner::readCases(inStream, cases, error))
+        {
+            err << inputFile.fileName() << ": " << error << '\n';
+            return 2;
+        }
+    }
+    if(cases.isEmpty() && !parser.isSet(fileOption))
+    {
+        QTextStream inStream(stdin);
+        QString error;
+        if(!TMBatchRunner::readCases(inStream, cases, error))
+        {
+            err << "Standard input: " << error << '\n';
+            return 2;
+        }
+    }
+
+    if(!other.isNull())
+    {
+        QStringList inputs;
+        for(const TMBatchRunner::Case &testCase : cases)
+            inputs.append(testCase.input);
+        checker.checkCorpus(inputs);
+        return reportEquivalence(checker, out, err);
+    }
+
+    //Run every input across all cores:
+    TMBatchRunner runner;
+    runner.setMachine(&machine);
+    runner.setLeftBounded(!parser.isSet(twoWayOption));
+    runner.setRunConfig(config);
+    if(parser.isSet(interpretedOption))
+        runner.setExecutionMode(TMProcessor::Interpreted);
+    else if(parser.isSet(acceleratedOption))
+        runner.setExecutionMode(TMProcessor::Accelerated);
+    //A TM with several edges for the same state and symbol explores all of them:
+    else if(!machine.getCompiledMachine().isDeterministic())
+        runner.setExecutionMode(TMProcessor::Nondeterministic);
+    runner.setCases(cases);
+    runner.run();
+
+    //Print one line per input, in input order. Unmet expectations go to standard error:
+    bool expectations = false;
+    for(const TMBatchRunner::Result &result : runner.getResults())
+    {
+        out << result.input << '\t' << TMBatchRunner::outcomeName(result.outcome) << '\t' << result.steps;
+        if(!result.reason.isEmpty())
+            out << '\t' << result.reason;
+        out << '\n';
+
+        if(result.expected != TMBatchRunner::AnyOutcome)
+            expectations = true;
+        if(!result.passed)
+            err << "FAIL " << result.input << ": expected "
+                << TMBatchRunner::outcomeName(TMBatchRunner::Outcome(result.expected - 1)) << '\n';
+    }
+    out.flush();
+
+    err << cases.length() << " inputs: " << runner.getNumOutcomes(TMBatchRunner::Accepted) << " accepted, "
+        << runner.getNumOutcomes(TMBatchRunner::Crashed) << " crashed, "
+        << runner.getNumOutcomes(TMBatchRunner::Loop) << " infinite loops, "
+        << runner.getNumOutcomes(TMBatchRunner::LimitReached) << " stopped by a limit, "
+        << runner.getTotalSteps() << " steps in " << runner.getElapsedTime() << " ms\n";
+    if(expectations)
+    {
+        err << runner.getNumPassed() << " passed, " << runner.getNumFailed() << " failed\n";
+        return runner.getNumFailed() > 0 ? 1 : 0;
+    }
+    return 0;
+}